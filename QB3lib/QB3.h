@@ -29,7 +29,9 @@ Contributors:  Lucian Plesea
 extern "C" {
 #endif
 typedef struct encs * encsp; // encoder
+typedef const struct encs * qb3_configp; // encoder settings, read only
 typedef struct decs * decsp; // decoder
+typedef const struct decs * qb3_planp; // decoding plan, read only
 
 // Types
 enum qb3_dtype { QB3_U8 = 0, QB3_I8, QB3_U16, QB3_I16, QB3_U32, QB3_I32, QB3_U64, QB3_I64 };
@@ -63,6 +65,7 @@ enum qb3_error {
     QB3E_EINV, // Invalid parameter
     QB3E_UNKN, // Unknown
     QB3E_ERR,   // unspecified error
+    QB3E_NOSPACE, // Output buffer is too small
     QB3E_LIBERR = 255 // internal QB33 error, should not happen
 };
 
@@ -96,14 +99,87 @@ LIBQB3_EXPORT size_t qb3_max_encoded_size(const encsp p);
 // If mode value is out of range, it returns the previous mode value of p
 LIBQB3_EXPORT qb3_mode qb3_set_encoder_mode(encsp p, qb3_mode mode);
 
-//// Generate raw qb3 stream, no headers
-//LIBQB3_EXPORT void qb3_set_encoder_raw(encsp p);
+// Encode the image as independent strips of rows block rows (4 lines each), 0 for a single strip
+// Each strip starts with a fresh state and is byte aligned, the strip sizes are stored in the
+// header, which allows strips to be encoded and decoded in parallel
+// Returns the number of block rows per strip, which can be adjusted to keep the strip count valid
+LIBQB3_EXPORT size_t qb3_set_encoder_strips(encsp p, size_t rows);
+
+// Maximum number of threads used for encoding strips, 0 means the qb3_set_threads number
+// Defaults to 1, only used when the image is encoded as multiple strips
+LIBQB3_EXPORT void qb3_set_encoder_threads(encsp p, size_t threads);
+
+// Generate a raw qb3 stream, without headers. The size, bands, data type, mode, core bands and
+// quanta are not stored, the decoder needs them, see qb3_read_raw
+// A raw stream is a single strip, the strips setting is ignored
+LIBQB3_EXPORT void qb3_set_encoder_raw(encsp p);
+
+// Adaptive encoding, for images which mix smooth, noisy and synthetic areas, off by default
+// In the CF (best) modes, each row of blocks is encoded fast or best, depending on which one
+// was smaller on recently checked rows, which keeps most of the best mode gain at close to the
+// fast mode speed. No signaling is needed, the decoder handles both the same way
+// With strips, any strip that doesn't get smaller is stored instead, flagged in the strip index
+// The incremental encoder doesn't store strips, qb3_encode_bounded encodes them in a scratch buffer
+LIBQB3_EXPORT void qb3_set_encoder_adaptive(encsp p, bool adaptive);
 
 // Encode the source into destination buffer, which should be at least qb3_max_encoded_size
 // Source organization is expected to be y major, then x, then band (interleaved)
 // Returns actual size, the encoder can be reused
 LIBQB3_EXPORT size_t qb3_encode(encsp p, void *source, void *destination);
 
+// The size qb3_encode would return for this source, without writing any output
+// Returns 0 if it fails
+LIBQB3_EXPORT size_t qb3_encoded_size(encsp p, const void *source);
+
+// Same as qb3_encode, for a destination buffer of capacity bytes, which can be smaller
+// than qb3_max_encoded_size. The encoding stops as soon as the output doesn't fit and the
+// source is written in stored mode if that fits. Otherwise it returns 0 and the encoder
+// state is QB3E_NOSPACE. In the RLE modes, packing is dropped if it doesn't help or doesn't fit,
+// so a capacity of the qb3_encode size gives the same output
+LIBQB3_EXPORT size_t qb3_encode_bounded(encsp p, void *source, void *destination, size_t capacity);
+
+// Estimates the encoded size by encoding a fraction of the rows of blocks, spread over the image
+// sizes, if not null, receives five estimates in bytes: fast, best, fast + RLE, best + RLE and stored
+// Returns the mode to use, keeping the current scanning curve. A slower mode is chosen only when it
+// is estimated to be smaller by at least the gain fraction, for example 0.05 for 5%
+// QB3M_INVALID means the estimate failed. If the data doesn't compress, the fastest mode is
+// returned, qb3_encode stores it in that case
+LIBQB3_EXPORT qb3_mode qb3_estimate(encsp p, void *source, double fraction, double gain, size_t *sizes);
+
+// Creates a read only copy of the encoder settings, returns nullptr if it fails
+// The encoder can be destroyed, the configuration can be used by many threads at once
+LIBQB3_EXPORT qb3_configp qb3_create_config(const encsp p);
+
+// Same as qb3_encode, with the settings from config. All the encoding state is local to the call
+// Returns the encoded size, 0 if it fails
+LIBQB3_EXPORT size_t qb3_encode_with(qb3_configp config, const void *source, void *destination);
+
+LIBQB3_EXPORT void qb3_destroy_config(qb3_configp config);
+
+// Encodes n images of the same size, band count and type, using the read only settings in config,
+// which can also be an encoder. The output is the same as qb3_encode_with for each image
+// The images are spread over up to the configured number of threads, see qb3_set_encoder_threads
+// On input, sizes holds the capacity of each destination, 0 meaning qb3_max_encoded_size or more
+// On output, it receives the encoded sizes, 0 for the images which failed or didn't fit
+// Returns the number of images encoded, 0 if the arguments are not valid
+LIBQB3_EXPORT size_t qb3_encode_batch(qb3_configp config, size_t n, void **sources,
+    void **destinations, size_t *sizes);
+
+// Incremental encoding, the lines are passed in as they become available
+// Starts writing to destination, which should be at least qb3_max_encoded_size
+// The encoder settings should not change until qb3_encode_end. Returns false on failure
+LIBQB3_EXPORT bool qb3_encode_begin(encsp p, void *destination);
+
+// Encodes the next nrows lines, organized the same as the qb3_encode source
+// Any number of lines can be passed, they are encoded four at a time. Returns false on failure
+LIBQB3_EXPORT bool qb3_encode_rows(encsp p, const void *rows, size_t nrows);
+
+// Call after all the lines have been passed, returns the encoded size or 0 on failure
+// The output is the same as qb3_encode, except it is never switched to the stored mode
+// A raw stream in an RLE mode is always packed, it fails if packing grows the data too much
+// A raw stream fails if it is exactly the decoded size, since it would be read as stored
+LIBQB3_EXPORT size_t qb3_encode_end(encsp p);
+
 // Returns !0 if last encode call failed
 LIBQB3_EXPORT int qb3_get_encoder_state(encsp p);
 
@@ -121,6 +197,47 @@ LIBQB3_EXPORT bool qb3_read_info(decsp p);
 // Call after qb3_read_info, reads all the data, returns bytes read
 LIBQB3_EXPORT size_t qb3_read_data(decsp p, void* destination);
 
+// Call after qb3_read_info, instead of qb3_read_data. Reads only the window of w x h pixels at x0, y0
+// stride is the line to line distance in the destination, in values, 0 means w * bands
+// Only the rows of blocks up to the end of the window are decoded, returns bytes written or 0 if it fails
+LIBQB3_EXPORT size_t qb3_read_window(decsp p, size_t x0, size_t y0, size_t w, size_t h,
+    void* destination, size_t stride);
+
+// Call after qb3_read_info, instead of qb3_read_data. Each call reads the next row of blocks,
+// which is 4 lines or fewer at the bottom edge, into destination
+// stride is the line to line distance in the destination, in values, 0 means xsize * bands
+// The number of lines read is placed in rows, if not null
+// Returns bytes written, 0 after the last line or if it fails
+LIBQB3_EXPORT size_t qb3_read_rows(decsp p, void* destination, size_t stride, size_t* rows);
+
+// Starts reading a raw QB3 stream, as written by an encoder set with qb3_set_encoder_raw
+// Use instead of qb3_read_start and qb3_read_info. The image size, number of bands, data type and
+// mode are the ones used for encoding. Returns nullptr if they are not valid
+// The core bands and quanta default to the encoder defaults, they can be changed before reading
+LIBQB3_EXPORT decsp qb3_read_raw(void* source, size_t source_size, size_t width, size_t height,
+    size_t bands, qb3_dtype dt, qb3_mode mode);
+
+// Sets the core band mapping of a raw stream decoder, returns false if it is not valid
+LIBQB3_EXPORT bool qb3_set_decoder_coreband(decsp p, size_t bands, const size_t *cband);
+
+// Sets the quanta of a raw stream decoder, 1 means no quantization. Returns false if it fails
+LIBQB3_EXPORT bool qb3_set_decoder_quanta(decsp p, size_t q);
+
+// Creates a decoding plan, for many images with the same parameters. Call after qb3_read_info
+// or qb3_read_raw, the plan keeps the decoder settings except the input. Returns nullptr if it fails
+// The decoder can be destroyed, the plan does not change and can be used by many threads at once
+LIBQB3_EXPORT qb3_planp qb3_create_plan(const decsp p);
+
+// Decodes source, which is the same kind of stream the plan was created from. The headers of
+// formatted streams are read, the image size, bands and data type have to match the plan
+// stride is the line to line distance in the destination, in values, 0 means xsize * bands
+// Does not allocate memory, except for the RLE modes or when multiple strips are decoded in parallel
+// Returns bytes written, 0 if it fails
+LIBQB3_EXPORT size_t qb3_decode_with_plan(qb3_planp plan, const void *source, size_t source_size,
+    void *destination, size_t stride);
+
+LIBQB3_EXPORT void qb3_destroy_plan(qb3_planp plan);
+
 LIBQB3_EXPORT void qb3_destroy_decoder(decsp p);
 
 LIBQB3_EXPORT size_t qb3_decoded_size(const decsp p);
@@ -130,6 +247,10 @@ LIBQB3_EXPORT qb3_dtype qb3_get_type(const decsp p);
 // Set line to line to line stride for decoder, defaults to line size
 LIBQB3_EXPORT void qb3_set_decoder_stride(decsp p, size_t stride);
 
+// Maximum number of threads used for decoding, 0 means the qb3_set_threads number
+// Defaults to 1, only used when the image was encoded as multiple strips
+LIBQB3_EXPORT void qb3_set_decoder_threads(decsp p, size_t threads);
+
 // Query settings, valid after qb3_read_info
 
 // Encoding mode used, returns QB3M_INVALID if failed
@@ -144,6 +265,26 @@ LIBQB3_EXPORT size_t qb3_get_order(const decsp p);
 // Sets the cband array and returns true if successful
 LIBQB3_EXPORT bool qb3_get_coreband(const decsp p, size_t *cband);
 
+
+// In QB3threads.cpp
+
+// Number of threads the library uses, shared by all the encoders and decoders. The calling thread
+// is one of them, the rest are kept in a pool. 0 means one per CPU core, which is the default
+// The encoder and decoder thread settings limit the number of threads used by each call, 0 there
+// means this number
+LIBQB3_EXPORT void qb3_set_threads(size_t threads);
+
+// A unit of work, to be called once with the arg it was submitted with
+typedef void (*qb3_task)(void *arg);
+
+// Should call task(arg) once, on any thread. context is the one passed to qb3_set_executor
+typedef void (*qb3_executor)(qb3_task task, void *arg, void *context);
+
+// Runs the library tasks with the host application executor instead of the internal pool
+// A null executor restores the pool. The calling thread also works and it doesn't wait for the
+// tasks which didn't start yet, so they can run late, or inline
+LIBQB3_EXPORT void qb3_set_executor(qb3_executor executor, void *context);
+
 #if defined(__cplusplus)
 }
 
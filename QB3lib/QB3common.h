@@ -21,11 +21,20 @@ Contributors:  Lucian Plesea
 #include <cinttypes>
 #include <utility>
 #include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
 
 #if defined(_WIN32)
 #include <intrin.h>
 #endif
 
+#if defined(__SSE2__) || defined(__AVX2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 // Tables have 12bits of data, top 4 bits are size
 constexpr auto TBLMASK(0xfffull);
 
@@ -33,11 +42,6 @@ constexpr auto TBLMASK(0xfffull);
 constexpr size_t B(4);
 constexpr size_t B2(B * B);
 
-#if defined(__GNUC__) && defined(__x86_64__)
-// Comment out if binary is to run on processors without sse4
-#pragma GCC target("sse4")
-#endif
-
 #if defined(_WIN32)
 // blog2 of val, result is undefined for val == 0
 static size_t topbit(uint64_t val) {
@@ -99,9 +103,20 @@ struct encs {
 
     int error; // Holds the code for error, 0 if everything is fine
 
+    // Block rows per independent strip, 0 if the image is a single strip
+    size_t strip;
+    // Maximum number of threads used to encode strips
+    size_t threads;
+    // Instruction set specific code
+    const struct qb3_kernels* kernels;
+    // Incremental encoding state, between qb3_encode_begin and qb3_encode_end
+    struct enc_stream* stream;
+
     qb3_mode mode;
     qb3_dtype type;
     bool away; // Round up instead of down when quantizing
+    bool raw; // No headers, the decoder gets the parameters some other way
+    bool adaptive; // Pick the encoding per row of blocks and the stored strips
 };
 
 // Decoder control structure
@@ -125,8 +140,76 @@ struct decs {
     // Input buffer
     uint8_t* s_in;
     size_t s_size;
+
+    // Block rows per independent strip, 0 if the image is a single strip
+    size_t strip;
+    // Strip sizes, 4 bytes each, points inside the input header
+    const uint8_t* s_index;
+    // Number of threads used to decode strips, 0 for all available
+    size_t threads;
+    // Instruction set specific code
+    const struct qb3_kernels* kernels;
+    // Incremental decoding state, see qb3_read_rows
+    struct dec_stream* stream;
+    // Raw stream, the parameters are not read from the input
+    bool raw;
 };
 
+// Encoding and decoding entry points, built for each instruction set, see QB3kernels.cpp
+struct qb3_kernels {
+    // Encode at bit position pos of out, which gets updated. Returns an error code
+    // If out is null, the bits are only counted
+    int (*encode)(const void* image, uint8_t* out, size_t& pos, encs& info, bool best);
+    // Decode the whole image, returns true on failure
+    bool (*decode)(uint8_t* src, size_t len, void* image, const decs& info);
+    // Decode the lines [y0, y1) and columns [x0, x0 + w) of an image which starts at line top
+    // The buffer holds B lines, returns true on failure
+    bool (*window)(uint8_t* src, size_t len, const decs& info, size_t top, size_t y0, size_t y1,
+        size_t x0, size_t w, void* dest, size_t stride, void* buffer);
+    // Decode one row of blocks at bit position pos of src, which gets updated, as does the band state
+    // Returns true on failure
+    bool (*row)(uint8_t* src, size_t len, size_t& pos, void* image, size_t stride, const decs& info,
+        band_state* state);
+};
+
+// The best kernels for this CPU, the QB3_ISA environment variable can select a specific one
+const qb3_kernels* qb3_select_kernels();
+
+// Maximum number of strips, limited by the strip index chunk size
+constexpr size_t QB3_MAXSTRIPS(16383);
+
+// Flag set in the strip index size of a strip which is stored instead of encoded
+constexpr size_t QB3_STORED_STRIP(size_t(1) << 31);
+
+// Number of strips in an image, 1 if strips are not used
+static inline size_t strip_count(size_t ysize, size_t rows) {
+    return rows ? ((ysize + B - 1) / B + rows - 1) / rows : 1;
+}
+
+// Line range covered by strip i, first line and last line + 1
+// The last strip is moved up if needed, so it is at least B lines tall
+static inline std::pair<size_t, size_t> strip_lines(size_t ysize, size_t rows, size_t i) {
+    if (0 == rows)
+        return std::make_pair(size_t(0), ysize);
+    size_t end = std::min(ysize, (i + 1) * rows * B);
+    return std::make_pair(std::min(i * rows * B, end - B), end);
+}
+
+// In QB3threads.cpp
+// Number of threads to use, threads if not 0, otherwise the library setting
+size_t qb3_threads(size_t threads);
+// Calls fn(ctx, i) for every i in [0, count), using up to threads threads, see parallel_for
+void qb3_parallel(size_t count, size_t threads, void (*fn)(void*, size_t), void* ctx);
+
+// Calls fn(i) for every i in [0, count), using up to threads threads, 0 means the library setting
+// The calling thread is one of the workers, the others come from the library pool or executor
+// With a single thread the calls are in order
+template<typename F>
+static void parallel_for(size_t count, size_t threads, const F& fn) {
+    qb3_parallel(count, threads, [](void* f, size_t i) { (*static_cast<const F*>(f))(i); },
+        const_cast<F*>(&fn));
+}
+
 // in decode.cpp
 extern const int typesizes[8];
 
@@ -147,6 +230,23 @@ static T smag(T v) {
     return (v >> 1) ^ (~T(0) * (v & 1));
 }
 
+// Absolute from mag-sign
+template<typename T> static T magsabs(T v) { return (v >> 1) + (v & 1); }
+
+// Larger of two values, std::max is not local to each instruction set build
+template<typename T> static T vmax(T a, T b) { return (a < b) ? b : a; }
+
+namespace { // Built for more than one instruction set, keep it local
+// Values are encoded and decoded as they are, the alternative is quantization
+template<typename T> struct raw {
+    static constexpr bool identity = true;
+    T operator()(T v) const { return v; }
+#if defined(__AVX2__)
+    __m256i operator()(__m256i v) const { return v; }
+#endif
+};
+} // namespace
+
 // If the rung bits of the input values match 1*0*, returns the index of first 0, otherwise B2 + 1
 template<typename T>
 static size_t step(const T* const v, size_t rung) {
@@ -160,6 +260,109 @@ static size_t step(const T* const v, size_t rung) {
     return B2 + s - !s * setbits16(acc);
 }
 
+// Same as above, the rung bits are moved to the sign position and collected with a movemask
+// Bit i of the mask is the rung bit of v[i], a step is a mask of the form 0*1*
+#if defined(__SSE2__)
+static inline size_t step(const uint8_t* const v, size_t rung) {
+    auto r = _mm_sll_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v)), _mm_cvtsi32_si128(int(7 - rung)));
+    uint64_t m = static_cast<uint32_t>(_mm_movemask_epi8(r));
+    return (m & (m + 1)) ? B2 + 1 : setbits16(m);
+}
+
+static inline size_t step(const uint16_t* const v, size_t rung) {
+    auto s = _mm_cvtsi32_si128(int(15 - rung));
+    auto r = _mm_packs_epi16(_mm_sll_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v)), s),
+        _mm_sll_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + 8)), s));
+    uint64_t m = static_cast<uint32_t>(_mm_movemask_epi8(r));
+    return (m & (m + 1)) ? B2 + 1 : setbits16(m);
+}
+#endif
+
+#if defined(__AVX2__)
+static size_t step(const uint32_t* const v, size_t rung) {
+    auto s = _mm_cvtsi32_si128(int(31 - rung));
+    auto lo = _mm256_sll_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v)), s);
+    auto hi = _mm256_sll_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + 8)), s);
+    uint64_t m = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lo))
+        | (_mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8));
+    return (m & (m + 1)) ? B2 + 1 : setbits16(m);
+}
+
+static size_t step(const uint64_t* const v, size_t rung) {
+    auto s = _mm_cvtsi32_si128(int(63 - rung));
+    uint64_t m = 0;
+    for (size_t j = 0; j < B2; j += 4) {
+        auto r = _mm256_sll_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + j)), s);
+        m |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(r))) << j;
+    }
+    return (m & (m + 1)) ? B2 + 1 : setbits16(m);
+}
+#endif
+
+#if defined(__BMI2__)
+// Values of type T per 64bit word, and a mask with the low bit of each value set
+template<typename T> struct lanes {
+    static constexpr size_t N = 8 / sizeof(T);
+    static constexpr uint64_t LSB = ~0ull / static_cast<uint64_t>(static_cast<T>(~T(0)));
+};
+
+// Bit i of the result is bit k of v[i]
+template<typename T>
+static uint64_t bitplane(const T* const v, size_t k) {
+    uint64_t m = 0;
+    for (size_t i = 0; i < B2; i += lanes<T>::N) {
+        uint64_t w;
+        memcpy(&w, v + i, sizeof(w));
+        m |= _pext_u64(w, lanes<T>::LSB << k) << i;
+    }
+    return m;
+}
+
+// Sets v[i] to bit i of m
+template<typename T>
+static void unbitplane(T* v, uint64_t m) {
+    for (size_t i = 0; i < B2; i += lanes<T>::N) {
+        uint64_t w = _pdep_u64(m >> i, lanes<T>::LSB);
+        memcpy(v + i, &w, sizeof(w));
+    }
+}
+#endif
+
+// RLE0FFFF scanning, a run or a marker starts with a pair of equal 0xFF bytes or of 0 bytes
+// Returns the number of bytes before the first pair, checking at most len starting positions
+// The zero pairs are only considered when zeros is set. Reads up to s[len]
+static inline size_t rle_literals(const uint8_t* s, size_t len, bool zeros) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const auto zmask = _mm256_set1_epi8(zeros ? -1 : 0);
+    for (; i + 32 <= len; i += 32) {
+        auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 1));
+        auto special = _mm256_or_si256(_mm256_cmpeq_epi8(a, _mm256_set1_epi8(-1)),
+            _mm256_and_si256(zmask, _mm256_cmpeq_epi8(a, _mm256_setzero_si256())));
+        uint64_t m = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(special, _mm256_cmpeq_epi8(a, b))));
+        if (m)
+            return i + topbit(m & (~m + 1));
+    }
+#endif
+#if defined(__SSE2__)
+    const auto zmask16 = _mm_set1_epi8(zeros ? -1 : 0);
+    for (; i + 16 <= len; i += 16) {
+        auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 1));
+        auto special = _mm_or_si128(_mm_cmpeq_epi8(a, _mm_set1_epi8(-1)),
+            _mm_and_si128(zmask16, _mm_cmpeq_epi8(a, _mm_setzero_si128())));
+        uint64_t m = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(special, _mm_cmpeq_epi8(a, b))));
+        if (m)
+            return i + topbit(m & (~m + 1));
+    }
+#endif
+    for (; i < len; i++)
+        if (s[i] == s[i + 1] && (0xff == s[i] || (zeros && 0 == s[i])))
+            return i;
+    return len;
+}
+
 // Two QB3 standard parsing order, encoded as a single 64bit value
 // each nibble holds the adress of a pixel, two bits for x and two bits for y
 // Use nibble values in the identity matrix, read in the desired order
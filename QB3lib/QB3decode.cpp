@@ -16,7 +16,7 @@ Contributors:  Lucian Plesea
 */
 
 #pragma warning(disable:4127) // conditional expression is constant
-#include "QB3decode.h"
+#include "QB3common.h"
 // For memset, memcpy
 #include <cstring>
 #include <vector>
@@ -30,7 +30,87 @@ Contributors:  Lucian Plesea
 // 1 mode
 constexpr size_t QB3_HDRSZ = 4 + 2 + 2 + 1 + 1 + 1;
 
+// Upper bound of the input bytes used by a row of blocks, plus the read ahead
+static size_t max_row_bytes(const decsp p) {
+    return ((p->xsize + B - 1) / B) * p->nbands * (2 * B2 * typesizes[p->type] + 16) + 8;
+}
+
+// Input of a strip, for decoding one row of blocks at a time
+// In the RLE modes the input is expanded as needed into a window, which holds enough
+// for the next row of blocks, instead of expanding the whole strip
+class strip_input {
+public:
+    strip_input(uint8_t* src = nullptr, size_t size = 0, bool rle = false, size_t ahead = 0)
+        : src(src), len(size), rle(rle), ahead(ahead), used(0) {}
+
+    // Makes the input for the row starting at bit position pos available
+    // The window moves forward, so pos gets adjusted
+    void fill(size_t& pos) {
+        if (!rle)
+            return;
+        // Drop the bytes already decoded
+        auto drop = std::min(pos / 8, window.size());
+        window.erase(window.begin(), window.begin() + drop);
+        pos -= drop * 8;
+        auto want = pos / 8 + ahead;
+        while (window.size() < want && used < len) {
+            // Copy the literals up to the next marker in bulk
+            // A marker needs two more bytes, so the last two are always literal
+            auto check = (len - used > 2) ? len - used - 2 : 0;
+            auto span = rle_literals(src + used, std::min(check, want - window.size()), false);
+            if (span) {
+                window.insert(window.end(), src + used, src + used + span);
+                used += span;
+            }
+            else {
+                expand();
+            }
+        }
+    }
+
+    uint8_t* data() { return rle ? window.data() : src; }
+    size_t size() const { return rle ? window.size() : len; }
+
+private:
+    // Expands one RLE0FFFF code
+    // FF FF FF -> FF FF
+    // FF FF N -> N + 4 zeros
+    void expand() {
+        uint8_t c = src[used++];
+        if (0xff != c || len - used < 2 || 0xff != src[used]) { // Not a marker
+            window.push_back(c);
+            return;
+        }
+        c = src[used + 1];
+        used += 2;
+        if (0xff == c)
+            window.insert(window.end(), 2, 0xff);
+        else
+            window.insert(window.end(), size_t(4) + c, 0);
+    }
+
+    uint8_t* src;
+    size_t len;
+    bool rle;
+    size_t ahead; // Bytes kept available after the current position
+    size_t used;  // Input bytes expanded
+    std::vector<uint8_t> window;
+};
+
+// Incremental decoding state
+struct dec_stream {
+    size_t line;     // Next line to return
+    size_t strip;    // Current strip
+    size_t y;        // Next row of blocks, relative to the strip
+    size_t pos;      // Bit position in the strip input
+    band_state state[QB3_MAXBANDS];
+    std::vector<size_t> offset; // Strip offsets
+    strip_input in;  // Strip data
+    std::vector<uint8_t> buffer; // B lines, for the last row
+};
+
 void qb3_destroy_decoder(decsp p) {
+    delete p->stream;
     delete p;
 }
 
@@ -42,10 +122,15 @@ qb3_dtype qb3_get_type(const decsp p) {
     return p->type;
 }
 
+// Raw streams are stored when they have the decoded size
+static bool is_stored(const decsp p, size_t src_sz) {
+    return qb3_mode::QB3M_STORED == p->mode || (p->raw && src_sz == qb3_decoded_size(p));
+}
+
 qb3_mode qb3_get_mode(const decsp p) {
     if (p->stage != 2)
         return qb3_mode::QB3M_INVALID;
-    return p->mode;
+    return is_stored(p, p->s_size) ? qb3_mode::QB3M_STORED : p->mode;
 }
 
 size_t qb3_get_quanta(const decsp p) {
@@ -74,36 +159,8 @@ void qb3_set_decoder_stride(decsp p, size_t stride) {
     p->stride = stride;
 }
 
-// Integer multiply but don't overflow, at least on the positive side
-template<typename T>
-static void dequantize(T* d, const decsp p) {
-    size_t sz = qb3_decoded_size(p) / sizeof(T);
-    const T q = static_cast<T>(p->quanta);
-    const T mai = std::numeric_limits<T>::max() / q; // Top valid value
-    const T mii = std::numeric_limits<T>::min() / q; // Bottom valid value
-    auto stride = p->stride ? p->stride : (p->xsize * p->nbands * sizeof(T));
-    // Slightly faster without a double loop
-    if (stride == p->xsize * p->nbands * sizeof(T)) {
-        for (size_t i = 0; i < sz; i++) {
-            auto data = d[i];
-            d[i] = (data <= mai) * (data * q)
-                + (!(data <= mai)) * std::numeric_limits<T>::max();
-            if (std::is_signed<T>() && (q > 2) && (data < mii))
-                d[i] = std::numeric_limits<T>::min();
-        }
-        return;
-    }
-    // With line stride
-    for (size_t y = 0; y < p->ysize; y++) {
-        auto dst = reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(d) + y * stride);
-        for (size_t i = 0; i < p->nbands * p->xsize; i++) {
-            auto data = dst[i];
-            dst[i] = (data <= mai) * (data * q)
-                + (!(data <= mai)) * std::numeric_limits<T>::max();
-            if (std::is_signed<T>() && (q > 2) && (data < mii))
-                dst[i] = std::numeric_limits<T>::min();
-        }
-    }
+void qb3_set_decoder_threads(decsp p, size_t threads) {
+    p->threads = threads;
 }
 
 // Check a 2 byte signature
@@ -123,18 +180,21 @@ static bool check_curve(uint64_t val) {
     return mask == 0xffff;
 }
 
-// Starts reading a formatted QB3 source
-// returns nullptr if it fails, usually because the source is not in the correct format
-// If successful, size containts 3 values, x size, y size and number of bands
-decsp qb3_read_start(void* source, size_t source_size, size_t *image_size) {
-    if (source_size < QB3_HDRSZ + 4 || nullptr == image_size)
-        return nullptr; // Too short to be a QB3 format stream
+// Reads the main header of a formatted QB3 source into p
+// Returns false if the source is not in the correct format
+static bool read_start(decsp p, void* source, size_t source_size) {
+    if (source_size < QB3_HDRSZ + 4)
+        return false; // Too short to be a QB3 format stream
     iBits s(reinterpret_cast<uint8_t*>(source), source_size);
     auto val = s.pull(64);
     if (!check_sig(val, "QB") || !check_sig(val >> 16, "3\200"))
-        return nullptr;
-    auto p = new decs;
+        return false;
     memset(p, 0, sizeof(decs));
+    // Default band mapping is identity, the CB chunk is optional
+    for (size_t c = 0; c < QB3_MAXBANDS; c++)
+        p->cband[c] = static_cast<uint8_t>(c);
+    p->threads = 1;
+    p->kernels = qb3_select_kernels();
     val >>= 32;
     p->xsize = 1 + (val & 0xffff);
     val >>= 16;
@@ -151,22 +211,33 @@ decsp qb3_read_start(void* source, size_t source_size, size_t *image_size) {
     if (p->nbands > QB3_MAXBANDS 
         || (p->mode > qb3_mode::QB3M_BEST && p->mode != qb3_mode::QB3M_STORED)
         || 0 != (val & 0x8080) 
-        || p->type > qb3_dtype::QB3_I64) {
-        delete p;
-        return nullptr;
-    }
+        || p->type > qb3_dtype::QB3_I64)
+        return false;
     p->s_in = static_cast<uint8_t*>(source) + QB3_HDRSZ;
     p->s_size = source_size - QB3_HDRSZ;
+    if (QB3M_BASE_Z == p->mode || QB3M_CF == p->mode || QB3M_CF_RLE == p->mode || QB3M_RLE == p->mode)
+        p->order = ZCURVE;
+    p->error = QB3E_OK;
+    p->stage = 1; // Read main header
+    return true; // Looks reasonable
+}
 
+// Starts reading a formatted QB3 source
+// returns nullptr if it fails, usually because the source is not in the correct format
+// If successful, size containts 3 values, x size, y size and number of bands
+decsp qb3_read_start(void* source, size_t source_size, size_t *image_size) {
+    if (nullptr == image_size)
+        return nullptr;
+    auto p = new decs;
+    if (!read_start(p, source, source_size)) {
+        delete p;
+        return nullptr;
+    }
     // Pass back the image size
     image_size[0] = p->xsize;
     image_size[1] = p->ysize;
     image_size[2] = p->nbands;
-    if (QB3M_BASE_Z == p->mode || QB3M_CF == p->mode || QB3M_CF_RLE == p->mode || QB3M_RLE == p->mode)
-        p->order = ZCURVE;
-    p->error = QB3E_OK;
-    p->stage = 1; // Read main header
-    return p; // Looks reasonable
+    return p;
 }
 
 // read the rest of the qb3 stream metadata
@@ -225,6 +296,21 @@ bool qb3_read_info(decsp p) {
             p->s_size -= used;
             p->stage = 2; // Seen data header
         }
+        else if (check_sig(chunk, "SI")) { // Strip index
+            // Block rows per strip, then 4 bytes per strip
+            if (len < 6 || s.avail() < 32 + size_t(len) * 8) {
+                p->error = QB3E_EINV;
+                break;
+            }
+            s.advance(32); // CHUNK + LEN
+            p->strip = static_cast<size_t>(s.pull(16));
+            if (0 == p->strip || len != 2 + 4 * strip_count(p->ysize, p->strip)) {
+                p->error = QB3E_EINV;
+                break;
+            }
+            p->s_index = p->s_in + s.position() / 8;
+            s.advance(size_t(len - 2) * 8);
+        }
         // For SC, read the curve in p->order
         else if (check_sig(chunk, "SC")) {          
             // len should be 8
@@ -260,150 +346,194 @@ bool qb3_read_info(decsp p) {
     return QB3E_OK == p->error;
 }
 
-// Decode RLE0FFFF data
-// Returns 0 if decoding worked as expected
-int64_t deRLE0FFFF(const uint8_t* s, size_t slen, uint8_t* d, size_t dlen) {
-    while ((slen > 0) && (dlen > 0)) {
-        slen--;
-        dlen--;
-        uint8_t c = *s++;
-        if ((0xFF != c) || (2 > slen)) { // Not code or not enough input
-            *d++ = c;
-        }
-        else { // check the second byte
-            if (0xff != s[0]) { // Not a marker, emit the 0xff
-                *d++ = 0xff;
-                continue;
-            }
-            // Consume the second FF and the byte after it
-            c = s[1];
-            s += 2;
-            slen -= 2;
-            if (c != 0xff) { // zero run
-                if (dlen < (size_t(3) + c))
-                    break; // output error, will exit
-                dlen -= size_t(3) + c;
-                *d++ = 0;
-                *d++ = 0;
-                *d++ = 0;
-                *d++ = 0;
-                while (c--)
-                    *d++ = 0;
-            }
-            else { // emit two FFs
-                if (!dlen)
-                    break; // output error, will exit
-                dlen--;
-                *d++ = 0xff;
-                *d++ = 0xff;
-            }
-        }
-    }
-    // Returns negative if the dest is not large enough, positive size of output when the input runs out
-    return static_cast<int64_t>(dlen) - static_cast<int64_t>(slen); // So it can become negative
-}
-
-// The size of the decoded data
-size_t deRLE0FFFFSize(const uint8_t* s, size_t slen) {
-    size_t count(0);
-    while (slen-- > 0) {
-        uint8_t c = *s++;
-        if ((0xFF != c) || (2 > slen) || (0xff != s[0])) {
-            count++;
-            continue;
-        }
-        c = s[1];
-        s += 2;
-        slen -= 2;
-        count += size_t(2) + (size_t(2) + c) * (0xff != c);
+// Starts reading a raw QB3 stream, the parameters are the ones used by the encoder
+decsp qb3_read_raw(void* source, size_t source_size, size_t width, size_t height,
+    size_t bands, qb3_dtype dt, qb3_mode mode)
+{
+    if (nullptr == source || 0 == source_size
+        || width < 4 || width > 0x10000ul || height < 4 || height > 0x10000ul
+        || bands == 0 || bands > QB3_MAXBANDS || dt > qb3_dtype::QB3_I64
+        || (mode > qb3_mode::QB3M_BEST && mode != qb3_mode::QB3M_STORED))
+        return nullptr;
+    auto p = new decs;
+    memset(p, 0, sizeof(decs));
+    p->xsize = width;
+    p->ysize = height;
+    p->nbands = bands;
+    p->type = dt;
+    p->mode = mode;
+    // Same defaults as the encoder
+    for (size_t c = 0; c < QB3_MAXBANDS; c++)
+        p->cband[c] = static_cast<uint8_t>(c);
+    if (bands == 3 || bands == 4)
+        p->cband[0] = p->cband[2] = 1;
+    p->quanta = 1;
+    if (QB3M_BASE_Z == mode || QB3M_CF == mode || QB3M_CF_RLE == mode || QB3M_RLE == mode)
+        p->order = ZCURVE;
+    p->threads = 1;
+    p->kernels = qb3_select_kernels();
+    p->s_in = static_cast<uint8_t*>(source);
+    p->s_size = source_size;
+    p->raw = true; // Stored if the size matches, the encoder only switches when it is not larger
+    p->error = QB3E_OK;
+    p->stage = 2; // Ready for data
+    return p;
+}
+
+bool qb3_set_decoder_coreband(decsp p, size_t bands, const size_t* cband) {
+    if (!p->raw || p->stream || bands != p->nbands)
+        return false;
+    uint8_t cb[QB3_MAXBANDS];
+    for (size_t i = 0; i < bands; i++) {
+        // Core bands have to be independent
+        if (cband[i] >= bands || cband[cband[i]] != cband[i])
+            return false;
+        cb[i] = static_cast<uint8_t>(cband[i]);
     }
-    return count;
+    memcpy(p->cband, cb, bands);
+    return true;
+}
+
+bool qb3_set_decoder_quanta(decsp p, size_t q) {
+    if (!p->raw || p->stream || q < 1)
+        return false;
+    p->quanta = q;
+    return true;
 }
 
 static bool needs_rle(qb3_mode mode) {
     return (QB3M_RLE == mode || QB3M_RLE_H == mode || QB3M_CF_RLE == mode || QB3M_CF_RLE_H == mode);
 }
 
+// Size of strip i in bytes, from the strip index
+static size_t strip_size(const decsp p, size_t i) {
+    auto v = p->s_index + 4 * i;
+    return (v[0] | (size_t(v[1]) << 8) | (size_t(v[2]) << 16) | (size_t(v[3]) << 24)) & ~QB3_STORED_STRIP;
+}
+
+// Strip i holds the values as they are, see qb3_set_encoder_adaptive
+static bool strip_stored(const decsp p, size_t i) {
+    return p->strip && (p->s_index[4 * i + 3] & (QB3_STORED_STRIP >> 24));
+}
+
+// The size of a stored strip has to match its lines
+static bool stored_size_ok(const decsp p, size_t i, size_t sz) {
+    auto lines = strip_lines(p->ysize, p->strip, i);
+    return sz == (lines.second - lines.first) * p->xsize * p->nbands * typesizes[p->type];
+}
+
+// Byte offsets of the strips in the source, followed by the end offset
+// Returns false if the strips don't fit
+static bool strip_offsets(const decsp p, size_t src_sz, std::vector<size_t>& offset) {
+    auto nstrips = strip_count(p->ysize, p->strip);
+    offset.assign(nstrips + 1, 0);
+    for (size_t i = 0; i < nstrips; i++) {
+        offset[i + 1] = offset[i] + (p->strip ? strip_size(p, i) : src_sz);
+        if (offset[i + 1] > src_sz)
+            return false;
+    }
+    return true;
+}
+
+// Decodes an RLE strip, one row of blocks at a time, returns true on failure
+// Reports the same errors as the decode kernel
+static bool decode_rle(const decsp p, uint8_t* src, size_t sz, const decs& sub, uint8_t* dst,
+    size_t stride)
+{
+    strip_input in(src, sz, true, max_row_bytes(p));
+    band_state state[QB3_MAXBANDS] = {};
+    size_t pos = 0;
+    for (size_t y = 0; y < sub.ysize; y += B) {
+        // If the last row is partial, roll it up
+        if (y + B > sub.ysize)
+            y = sub.ysize - B;
+        in.fill(pos);
+        if (p->kernels->row(in.data(), in.size(), pos, dst + y * stride * typesizes[p->type],
+            stride, sub, state))
+            return true;
+    }
+    // All the input should be used
+    in.fill(pos);
+    return in.size() * 8 - std::min(pos, in.size() * 8) > 7;
+}
+
 // returns 0 if an error is detected
 // TODO: Error reporting
 // source points to data to decode
 static size_t qb3_decode(decsp p, void* source, size_t src_sz, void* destination)
 {
-    int error_code = 0;
     auto src = reinterpret_cast<uint8_t *>(source);
 
     // If the data is stored and size is right, just copy it
-    if (p->mode == qb3_mode::QB3M_STORED) {
+    if (is_stored(p, src_sz)) {
         // Only if the size is what we expect
         if (src_sz != qb3_decoded_size(p)) {
             p->error = QB3E_EINV;
             return 0;
         }
-        memcpy(destination, source, src_sz);
+        auto linesize = p->xsize * p->nbands * typesizes[p->type];
+        if (0 == p->stride || p->stride * typesizes[p->type] == linesize) {
+            memcpy(destination, source, src_sz);
+            return src_sz;
+        }
+        for (size_t y = 0; y < p->ysize; y++)
+            memcpy(static_cast<uint8_t*>(destination) + y * p->stride * typesizes[p->type],
+                src + y * linesize, linesize);
         return src_sz;
     }
 
-    std::vector<uint8_t> buffer;
-    // If RLE is needed, it is expensive, allocates a whole new buffer
-    if (needs_rle(p->mode)) {
-        // RLE needs to be decoded into a temporary buffer
-        auto sz = deRLE0FFFFSize(src, src_sz);
-        buffer.resize(sz);
-        auto err = deRLE0FFFF(src, src_sz, buffer.data(), sz);
-        if (err != 0) {
+    // Strips are independent, each one starts with a clean state
+    auto stride = p->stride ? p->stride : p->xsize * p->nbands;
+    std::atomic<bool> failed(false);
+    auto decode_strip = [&](size_t i, size_t start, size_t end) {
+        auto lines = strip_lines(p->ysize, p->strip, i);
+        decs sub(*p);
+        sub.ysize = lines.second - lines.first;
+        auto dst = static_cast<uint8_t*>(destination) + lines.first * stride * typesizes[p->type];
+        if (strip_stored(p, i)) {
+            if (!stored_size_ok(p, i, end - start)) {
+                failed = true;
+                return;
+            }
+            auto linesize = p->xsize * p->nbands * typesizes[p->type];
+            for (size_t y = 0; y < sub.ysize; y++)
+                memcpy(dst + y * stride * typesizes[p->type], src + start + y * linesize, linesize);
+            return;
+        }
+        if (needs_rle(p->mode) ? decode_rle(p, src + start, end - start, sub, dst, stride)
+            : p->kernels->decode(src + start, end - start, dst, sub))
+            failed = true;
+    };
+    auto nstrips = strip_count(p->ysize, p->strip);
+    if (1 == nstrips || qb3_threads(p->threads) < 2) {
+        // In order, locating the strips as they are reached, doesn't need memory
+        for (size_t i = 0, start = 0; i < nstrips && !failed; i++) {
+            auto end = start + (p->strip ? strip_size(p, i) : src_sz);
+            if (end > src_sz)
+                failed = true;
+            else
+                decode_strip(i, start, end);
+            start = end;
+        }
+    }
+    else {
+        // Locate the strips, they have to fit in the input
+        std::vector<size_t> offset;
+        if (!strip_offsets(p, src_sz, offset)) {
             p->error = QB3E_EINV;
             return 0;
         }
-        // Retarget the source to the buffer
-        src = buffer.data();
-        src_sz = sz;
+        // A short last strip overlaps the previous one, decode it after the others
+        auto tail = (0 != p->ysize % B) ? size_t(1) : size_t(0);
+        parallel_for(nstrips - tail, p->threads, [&](size_t i) { decode_strip(i, offset[i], offset[i + 1]); });
+        if (tail)
+            decode_strip(nstrips - 1, offset[nstrips - 1], offset[nstrips]);
     }
-
-#define DEC(T) QB3::decode(src, src_sz, reinterpret_cast<T*>(destination), *p)
-    switch (p->type) {
-    case qb3_dtype::QB3_U8:
-    case qb3_dtype::QB3_I8:
-        error_code = DEC(uint8_t); break;
-    case qb3_dtype::QB3_U16:
-    case qb3_dtype::QB3_I16:
-        error_code = DEC(uint16_t); break;
-    case qb3_dtype::QB3_U32:
-    case qb3_dtype::QB3_I32:
-        error_code = DEC(uint32_t); break;
-    case qb3_dtype::QB3_U64:
-    case qb3_dtype::QB3_I64:
-        error_code = DEC(uint64_t); break;
-    default:
-        error_code = 3; // Invalid type
-    } // data type
-#undef DEC
-
-#define MUL(T) dequantize(reinterpret_cast<T *>(destination), p)
-    // We have a quanta, decode in place
-    if (!error_code && p->quanta > 1) {
-        switch (p->type) {
-        case qb3_dtype::QB3_U8:
-            MUL(uint8_t); break;
-        case qb3_dtype::QB3_I8:
-            MUL(int8_t); break;
-        case qb3_dtype::QB3_U16:
-            MUL(uint16_t); break;
-        case qb3_dtype::QB3_I16:
-            MUL(int16_t); break;
-        case qb3_dtype::QB3_U32:
-            MUL(uint32_t); break;
-        case qb3_dtype::QB3_I32:
-            MUL(int32_t); break;
-        case qb3_dtype::QB3_U64:
-            MUL(uint64_t); break;
-        case qb3_dtype::QB3_I64:
-            MUL(int64_t); break;
-        default:
-            error_code = 3; // Invalid type
-        } // data type
+    if (failed) {
+        p->error = QB3E_EINV;
+        return 0;
     }
-#undef MUL
-    return error_code ? 0 : qb3_decoded_size(p);
+    return qb3_decoded_size(p);
 }
 
 // Call after read_header to read the actual data
@@ -417,3 +547,235 @@ size_t qb3_read_data(decsp p, void* destination) {
     }
     return qb3_decode(p, p->s_in, p->s_size, destination);
 }
+
+qb3_planp qb3_create_plan(const decsp p) {
+    if (p->stage != 2 || p->error != QB3E_OK)
+        return nullptr;
+    auto plan = new decs(*p);
+    // The input is passed to each decode
+    plan->s_in = nullptr;
+    plan->s_index = nullptr;
+    plan->s_size = 0;
+    plan->stream = nullptr;
+    return plan;
+}
+
+// Decodes on a local copy of the plan, so it can be shared
+size_t qb3_decode_with_plan(qb3_planp plan, const void* source, size_t source_size,
+    void* destination, size_t stride)
+{
+    auto src = static_cast<uint8_t*>(const_cast<void*>(source));
+    decs d(*plan);
+    if (!plan->raw) {
+        // Each stream has its own headers, the image has to match the plan
+        if (!read_start(&d, src, source_size) || !qb3_read_info(&d)
+            || d.xsize != plan->xsize || d.ysize != plan->ysize
+            || d.nbands != plan->nbands || d.type != plan->type)
+            return 0;
+        d.threads = plan->threads;
+    }
+    else {
+        d.s_in = src;
+        d.s_size = source_size;
+    }
+    if (nullptr == d.s_in || 0 == d.s_size)
+        return 0;
+    d.stride = stride;
+    return qb3_decode(&d, d.s_in, d.s_size, destination);
+}
+
+void qb3_destroy_plan(qb3_planp plan) {
+    delete plan;
+}
+
+// Call after read_header, reads a rectangular window of the image
+size_t qb3_read_window(decsp p, size_t x0, size_t y0, size_t w, size_t h, void* destination, size_t stride) {
+    if (p->stage != 2 || p->error != QB3E_OK
+        || p->s_in == nullptr || p->s_size == 0
+        || 0 == w || 0 == h || x0 > p->xsize || w > p->xsize - x0 || y0 > p->ysize || h > p->ysize - y0) {
+        if (p->error == QB3E_OK)
+            p->error = QB3E_EINV;
+        return 0; // Error signal
+    }
+    auto tsz = typesizes[p->type];
+    auto linesize = w * p->nbands;
+    stride = stride ? stride : linesize;
+    auto dst = static_cast<uint8_t*>(destination);
+
+    if (is_stored(p, p->s_size)) {
+        if (p->s_size != qb3_decoded_size(p)) {
+            p->error = QB3E_EINV;
+            return 0;
+        }
+        for (size_t y = 0; y < h; y++)
+            memcpy(dst + y * stride * tsz,
+                p->s_in + ((y0 + y) * p->xsize + x0) * p->nbands * tsz, linesize * tsz);
+        return linesize * h * tsz;
+    }
+
+    std::vector<size_t> offset;
+    if (!strip_offsets(p, p->s_size, offset)) {
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    // Only the strips that overlap the window are decoded
+    // Each strip writes its own lines, a short last strip starts higher but writes only its lines
+    auto nstrips = offset.size() - 1;
+    auto rows = p->strip ? p->strip * B : p->ysize;
+    auto first = y0 / rows;
+    auto count = std::min(nstrips, (y0 + h - 1) / rows + 1) - first;
+    std::vector<int> errors(count);
+    parallel_for(count, p->threads, [&](size_t k) {
+        auto i = first + k;
+        auto lines = strip_lines(p->ysize, p->strip, i);
+        auto ly0 = std::max(y0, i * rows);
+        auto ly1 = std::min(y0 + h, lines.second);
+        if (ly0 >= ly1)
+            return;
+        auto ssrc = p->s_in + offset[i];
+        auto sz = offset[i + 1] - offset[i];
+        auto srcline = p->xsize * p->nbands * tsz;
+        if (strip_stored(p, i)) {
+            if (!stored_size_ok(p, i, sz)) {
+                errors[k] = QB3E_EINV;
+                return;
+            }
+            for (auto line = ly0; line < ly1; line++)
+                memcpy(dst + (line - y0) * stride * tsz,
+                    ssrc + (line - lines.first) * srcline + x0 * p->nbands * tsz, linesize * tsz);
+            return;
+        }
+        std::vector<uint8_t> lines_buffer(p->xsize * p->nbands * B * tsz);
+        decs sub(*p);
+        sub.ysize = lines.second - lines.first;
+        if (!needs_rle(p->mode)) {
+            errors[k] = p->kernels->window(ssrc, sz, sub, lines.first, ly0, ly1, x0, w,
+                dst + (ly0 - y0) * stride * tsz, stride, lines_buffer.data()) ? QB3E_EINV : 0;
+            return;
+        }
+        // Expand the RLE input only as far as needed
+        strip_input in(ssrc, sz, true, max_row_bytes(p));
+        band_state state[QB3_MAXBANDS] = {};
+        size_t pos = 0;
+        for (size_t y = 0; y < sub.ysize; y += B) {
+            if (y + B > sub.ysize)
+                y = sub.ysize - B;
+            in.fill(pos);
+            if (p->kernels->row(in.data(), in.size(), pos, lines_buffer.data(), p->xsize * p->nbands,
+                sub, state)) {
+                errors[k] = QB3E_EINV;
+                return;
+            }
+            for (size_t j = 0; j < B; j++) {
+                auto line = lines.first + y + j;
+                if (line >= ly0 && line < ly1)
+                    memcpy(dst + (line - y0) * stride * tsz,
+                        lines_buffer.data() + j * srcline + x0 * p->nbands * tsz, linesize * tsz);
+            }
+            if (lines.first + y + B >= ly1)
+                break;
+        }
+    });
+    for (auto err : errors)
+        if (err) {
+            p->error = err;
+            return 0;
+        }
+    return linesize * h * tsz;
+}
+
+// Starts decoding strip i, with a clean state
+static bool stream_strip(decsp p, size_t i) {
+    auto& st = *p->stream;
+    st.strip = i;
+    st.y = st.pos = 0;
+    for (auto& state : st.state)
+        state.prev = state.runbits = state.cf = 0;
+    st.in = strip_input(p->s_in + st.offset[i], st.offset[i + 1] - st.offset[i],
+        needs_rle(p->mode), max_row_bytes(p));
+    return !strip_stored(p, i) || stored_size_ok(p, i, st.offset[i + 1] - st.offset[i]);
+}
+
+// Call after read_header, reads the next row of blocks
+size_t qb3_read_rows(decsp p, void* destination, size_t stride, size_t* rows) {
+    if (rows)
+        *rows = 0;
+    if (p->stage != 2 || p->error != QB3E_OK
+        || p->s_in == nullptr || p->s_size == 0) {
+        if (p->error == QB3E_OK)
+            p->error = QB3E_EINV;
+        return 0; // Error signal
+    }
+    auto tsz = typesizes[p->type];
+    auto linesize = p->xsize * p->nbands;
+    stride = stride ? stride : linesize;
+    auto dst = static_cast<uint8_t*>(destination);
+
+    if (!p->stream) {
+        auto st = new dec_stream;
+        st->line = 0;
+        p->stream = st;
+        if (is_stored(p, p->s_size)) {
+            if (p->s_size != qb3_decoded_size(p))
+                p->error = QB3E_EINV;
+        }
+        else if (!strip_offsets(p, p->s_size, st->offset) || !stream_strip(p, 0))
+            p->error = QB3E_EINV;
+        if (p->error)
+            return 0;
+    }
+    auto& st = *p->stream;
+    if (st.line == p->ysize)
+        return 0; // Done
+
+    size_t n = std::min(B, p->ysize - st.line);
+    if (is_stored(p, p->s_size)) {
+        for (size_t y = 0; y < n; y++)
+            memcpy(dst + y * stride * tsz, p->s_in + (st.line + y) * linesize * tsz, linesize * tsz);
+    }
+    else {
+        auto lines = strip_lines(p->ysize, p->strip, st.strip);
+        if (st.y + lines.first >= lines.second) { // Next strip
+            if (!stream_strip(p, st.strip + 1)) {
+                p->error = QB3E_EINV;
+                return 0;
+            }
+            lines = strip_lines(p->ysize, p->strip, st.strip);
+        }
+        // If the last row is partial, roll it up
+        auto y = std::min(lines.first + st.y, lines.second - B);
+        st.y = y + B - lines.first;
+        // Lines already returned are skipped
+        n = y + B - st.line;
+        decs sub(*p);
+        sub.ysize = lines.second - lines.first;
+        bool failed = false;
+        if (strip_stored(p, st.strip)) {
+            auto ssrc = p->s_in + st.offset[st.strip];
+            for (size_t j = 0; j < n; j++)
+                memcpy(dst + j * stride * tsz, ssrc + (st.line + j - lines.first) * linesize * tsz,
+                    linesize * tsz);
+        }
+        else {
+            st.in.fill(st.pos);
+            if (n == B) {
+                failed = p->kernels->row(st.in.data(), st.in.size(), st.pos, dst, stride, sub, st.state);
+            }
+            else {
+                st.buffer.resize(linesize * B * tsz);
+                failed = p->kernels->row(st.in.data(), st.in.size(), st.pos, st.buffer.data(), linesize,
+                    sub, st.state);
+                for (size_t j = B - n; j < B; j++)
+                    memcpy(dst + (j + n - B) * stride * tsz, st.buffer.data() + j * linesize * tsz, linesize * tsz);
+            }
+        }
+        if (failed) {
+            p->error = QB3E_EINV;
+            return 0;
+        }
+    }
+    st.line += n;
+    if (rows)
+        *rows = n;
+    return n * linesize * tsz;
+}
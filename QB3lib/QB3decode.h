@@ -95,29 +95,588 @@ static const uint16_t drg7[] = { 0x7000, 0x8040, 0x7001, 0x9080, 0x7002, 0x8041,
 
 static const uint16_t* DRG[] = { drg0, drg1, drg2, drg3, drg4, drg5, drg6, drg7 };
 
-// rung 1 and 2 double value decoding tables, can use 8 bits
-static const uint8_t DDRG1[] = { 0x20, 0x31, 0x34, 0x42, 0x20, 0x45, 0x48, 0x43, 0x20, 0x31, 0x34, 0x56, 0x20, 0x59, 0x4c,
-0x57, 0x20, 0x31, 0x34, 0x42, 0x20, 0x45, 0x48, 0x43, 0x20, 0x31, 0x34, 0x6a, 0x20, 0x5d, 0x4c, 0x6b, 0x20, 0x31, 0x34, 0x42,
-0x20, 0x45, 0x48, 0x43, 0x20, 0x31, 0x34, 0x56, 0x20, 0x59, 0x4c, 0x57, 0x20, 0x31, 0x34, 0x42, 0x20, 0x45, 0x48, 0x43, 0x20,
-0x31, 0x34, 0x6e, 0x20, 0x5d, 0x4c, 0x6f };
-static const uint16_t DDRG2[] = { 0x4000, 0x5002, 0x4001, 0x6004, 0x5010, 0x5003, 0x5011, 0x6005, 0x4008, 0x6012, 0x4009,
-0x6006, 0x6020, 0x6013, 0x6021, 0x6007, 0x4000, 0x500a, 0x4001, 0x7014, 0x5018, 0x500b, 0x5019, 0x7015, 0x4008, 0x7022, 0x4009,
-0x7016, 0x6028, 0x7023, 0x6029, 0x7017, 0x4000, 0x5002, 0x4001, 0x600c, 0x5010, 0x5003, 0x5011, 0x600d, 0x4008, 0x601a, 0x4009,
-0x600e, 0x6030, 0x601b, 0x6031, 0x600f, 0x4000, 0x500a, 0x4001, 0x8024, 0x5018, 0x500b, 0x5019, 0x8025, 0x4008, 0x702a, 0x4009,
-0x8026, 0x6038, 0x702b, 0x6039, 0x8027, 0x4000, 0x5002, 0x4001, 0x6004, 0x5010, 0x5003, 0x5011, 0x6005, 0x4008, 0x6012, 0x4009,
-0x6006, 0x6020, 0x6013, 0x6021, 0x6007, 0x4000, 0x500a, 0x4001, 0x701c, 0x5018, 0x500b, 0x5019, 0x701d, 0x4008, 0x7032, 0x4009,
-0x701e, 0x6028, 0x7033, 0x6029, 0x701f, 0x4000, 0x5002, 0x4001, 0x600c, 0x5010, 0x5003, 0x5011, 0x600d, 0x4008, 0x601a, 0x4009,
-0x600e, 0x6030, 0x601b, 0x6031, 0x600f, 0x4000, 0x500a, 0x4001, 0x802c, 0x5018, 0x500b, 0x5019, 0x802d, 0x4008, 0x703a, 0x4009,
-0x802e, 0x6038, 0x703b, 0x6039, 0x802f, 0x4000, 0x5002, 0x4001, 0x6004, 0x5010, 0x5003, 0x5011, 0x6005, 0x4008, 0x6012, 0x4009,
-0x6006, 0x6020, 0x6013, 0x6021, 0x6007, 0x4000, 0x500a, 0x4001, 0x7014, 0x5018, 0x500b, 0x5019, 0x7015, 0x4008, 0x7022, 0x4009,
-0x7016, 0x6028, 0x7023, 0x6029, 0x7017, 0x4000, 0x5002, 0x4001, 0x600c, 0x5010, 0x5003, 0x5011, 0x600d, 0x4008, 0x601a, 0x4009,
-0x600e, 0x6030, 0x601b, 0x6031, 0x600f, 0x4000, 0x500a, 0x4001, 0x8034, 0x5018, 0x500b, 0x5019, 0x8035, 0x4008, 0x702a, 0x4009,
-0x8036, 0x6038, 0x702b, 0x6039, 0x8037, 0x4000, 0x5002, 0x4001, 0x6004, 0x5010, 0x5003, 0x5011, 0x6005, 0x4008, 0x6012, 0x4009,
-0x6006, 0x6020, 0x6013, 0x6021, 0x6007, 0x4000, 0x500a, 0x4001, 0x701c, 0x5018, 0x500b, 0x5019, 0x701d, 0x4008, 0x7032, 0x4009,
-0x701e, 0x6028, 0x7033, 0x6029, 0x701f, 0x4000, 0x5002, 0x4001, 0x600c, 0x5010, 0x5003, 0x5011, 0x600d, 0x4008, 0x601a, 0x4009,
-0x600e, 0x6030, 0x601b, 0x6031, 0x600f, 0x4000, 0x500a, 0x4001, 0x803c, 0x5018, 0x500b, 0x5019, 0x803d, 0x4008, 0x703a, 0x4009,
-0x803e, 0x6038, 0x703b, 0x6039, 0x803f };
-// rung 3 double value would be 2k by itself, the normal one is 64 bytes, and it gets worse from there
+// Multiple value decoding tables for rungs 1 to 3, 4, 3 and 2 values per lookup
+// Indexed by as many bits as the longest sequence, the values are packed in the low bits
+// and the total size is in the top 4 bits. 8k, 8k and 2k, generated by attic/tables.py
+static const uint16_t MDRG1[] = { 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xa02a, 0x6030, 0x908d, 0x909c, 0xa02b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xa02e, 0x80f0, 0x903d, 0x907c, 0xa02f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xa05a, 0x6030, 0x804d, 0x805c, 0xa05b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xa066, 0x80a0, 0xa069, 0x808c, 0xa067, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xa05e, 0x80b0, 0xa06d, 0x803c, 0xa05f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa08a, 0x6030, 0x700d, 0x701c, 0xa08b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa096, 0x7060, 0xa099, 0x704c, 0xa097, 0x4000, 0x7081, 0x7084, 0xa0a2, 0x7090, 0xa0a5, 0xa0a8, 0xa0a3, 0x60c0, 0x7031, 0x7034,
+0xa08e, 0x7070, 0xa09d, 0xa0ac, 0xa08f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xa03a, 0x6030, 0x90cd, 0x90dc, 0xa03b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xa076, 0x80e0, 0xa079, 0x80cc, 0xa077, 0x4000, 0x70c1, 0x70c4, 0xa0b2, 0x70d0, 0xa0b5, 0xa0b8, 0xa0b3, 0x60c0, 0x90f1, 0x90f4,
+0xa03e, 0x80f0, 0xa07d, 0xa0bc, 0xa03f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xb06a, 0x6030, 0x908d, 0x909c, 0xb06b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xb06e, 0x80f0, 0x903d, 0x907c, 0xb06f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xb09a, 0x6030, 0x804d, 0x805c, 0xb09b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xb0a6, 0x80a0, 0xb0a9, 0x808c, 0xb0a7, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xb09e, 0x80b0, 0xb0ad, 0x803c, 0xb09f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa0ca, 0x6030, 0x700d, 0x701c, 0xa0cb, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa0d6, 0x7060, 0xa0d9, 0x704c, 0xa0d7, 0x4000, 0x7081, 0x7084, 0xa0e2, 0x7090, 0xa0e5, 0xa0e8, 0xa0e3, 0x60c0, 0x7031, 0x7034,
+0xa0ce, 0x7070, 0xa0dd, 0xa0ec, 0xa0cf, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xb07a, 0x6030, 0x90cd, 0x90dc, 0xb07b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xb0b6, 0x80e0, 0xb0b9, 0x80cc, 0xb0b7, 0x4000, 0x70c1, 0x70c4, 0xa0f2, 0x70d0, 0xa0f5, 0xa0f8, 0xa0f3, 0x60c0, 0x90f1, 0x90f4,
+0xb07e, 0x80f0, 0xb0bd, 0xa0fc, 0xb07f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xa02a, 0x6030, 0x908d, 0x909c, 0xa02b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xa02e, 0x80f0, 0x903d, 0x907c, 0xa02f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xa05a, 0x6030, 0x804d, 0x805c, 0xa05b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xa066, 0x80a0, 0xa069, 0x808c, 0xa067, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xa05e, 0x80b0, 0xa06d, 0x803c, 0xa05f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa08a, 0x6030, 0x700d, 0x701c, 0xa08b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa096, 0x7060, 0xa099, 0x704c, 0xa097, 0x4000, 0x7081, 0x7084, 0xa0a2, 0x7090, 0xa0a5, 0xa0a8, 0xa0a3, 0x60c0, 0x7031, 0x7034,
+0xa08e, 0x7070, 0xa09d, 0xa0ac, 0xa08f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xa03a, 0x6030, 0x90cd, 0x90dc, 0xa03b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xa076, 0x80e0, 0xa079, 0x80cc, 0xa077, 0x4000, 0x70c1, 0x70c4, 0xa0b2, 0x70d0, 0xa0b5, 0xa0b8, 0xa0b3, 0x60c0, 0x90f1, 0x90f4,
+0xa03e, 0x80f0, 0xa07d, 0xa0bc, 0xa03f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xc0aa, 0x6030, 0x908d, 0x909c, 0xc0ab, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xc0ae, 0x80f0, 0x903d, 0x907c, 0xc0af, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xb0da, 0x6030, 0x804d, 0x805c, 0xb0db, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xb0e6, 0x80a0, 0xb0e9, 0x808c, 0xb0e7, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xb0de, 0x80b0, 0xb0ed, 0x803c, 0xb0df, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa0ca, 0x6030, 0x700d, 0x701c, 0xa0cb, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa0d6, 0x7060, 0xa0d9, 0x704c, 0xa0d7, 0x4000, 0x7081, 0x7084, 0xa0e2, 0x7090, 0xa0e5, 0xa0e8, 0xa0e3, 0x60c0, 0x7031, 0x7034,
+0xa0ce, 0x7070, 0xa0dd, 0xa0ec, 0xa0cf, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xc0ba, 0x6030, 0x90cd, 0x90dc, 0xc0bb, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xb0f6, 0x80e0, 0xb0f9, 0x80cc, 0xb0f7, 0x4000, 0x70c1, 0x70c4, 0xa0f2, 0x70d0, 0xa0f5, 0xa0f8, 0xa0f3, 0x60c0, 0x90f1, 0x90f4,
+0xc0be, 0x80f0, 0xb0fd, 0xa0fc, 0xc0bf, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xa02a, 0x6030, 0x908d, 0x909c, 0xa02b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xa02e, 0x80f0, 0x903d, 0x907c, 0xa02f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xa05a, 0x6030, 0x804d, 0x805c, 0xa05b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xa066, 0x80a0, 0xa069, 0x808c, 0xa067, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xa05e, 0x80b0, 0xa06d, 0x803c, 0xa05f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa08a, 0x6030, 0x700d, 0x701c, 0xa08b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa096, 0x7060, 0xa099, 0x704c, 0xa097, 0x4000, 0x7081, 0x7084, 0xa0a2, 0x7090, 0xa0a5, 0xa0a8, 0xa0a3, 0x60c0, 0x7031, 0x7034,
+0xa08e, 0x7070, 0xa09d, 0xa0ac, 0xa08f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xa03a, 0x6030, 0x90cd, 0x90dc, 0xa03b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xa076, 0x80e0, 0xa079, 0x80cc, 0xa077, 0x4000, 0x70c1, 0x70c4, 0xa0b2, 0x70d0, 0xa0b5, 0xa0b8, 0xa0b3, 0x60c0, 0x90f1, 0x90f4,
+0xa03e, 0x80f0, 0xa07d, 0xa0bc, 0xa03f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xb06a, 0x6030, 0x908d, 0x909c, 0xb06b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xb06e, 0x80f0, 0x903d, 0x907c, 0xb06f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xb09a, 0x6030, 0x804d, 0x805c, 0xb09b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xb0a6, 0x80a0, 0xb0a9, 0x808c, 0xb0a7, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xb09e, 0x80b0, 0xb0ad, 0x803c, 0xb09f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa0ca, 0x6030, 0x700d, 0x701c, 0xa0cb, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa0d6, 0x7060, 0xa0d9, 0x704c, 0xa0d7, 0x4000, 0x7081, 0x7084, 0xa0e2, 0x7090, 0xa0e5, 0xa0e8, 0xa0e3, 0x60c0, 0x7031, 0x7034,
+0xa0ce, 0x7070, 0xa0dd, 0xa0ec, 0xa0cf, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xb07a, 0x6030, 0x90cd, 0x90dc, 0xb07b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xb0b6, 0x80e0, 0xb0b9, 0x80cc, 0xb0b7, 0x4000, 0x70c1, 0x70c4, 0xa0f2, 0x70d0, 0xa0f5, 0xa0f8, 0xa0f3, 0x60c0, 0x90f1, 0x90f4,
+0xb07e, 0x80f0, 0xb0bd, 0xa0fc, 0xb07f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xa02a, 0x6030, 0x908d, 0x909c, 0xa02b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xa02e, 0x80f0, 0x903d, 0x907c, 0xa02f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xa05a, 0x6030, 0x804d, 0x805c, 0xa05b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xa066, 0x80a0, 0xa069, 0x808c, 0xa067, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xa05e, 0x80b0, 0xa06d, 0x803c, 0xa05f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa08a, 0x6030, 0x700d, 0x701c, 0xa08b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa096, 0x7060, 0xa099, 0x704c, 0xa097, 0x4000, 0x7081, 0x7084, 0xa0a2, 0x7090, 0xa0a5, 0xa0a8, 0xa0a3, 0x60c0, 0x7031, 0x7034,
+0xa08e, 0x7070, 0xa09d, 0xa0ac, 0xa08f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xa03a, 0x6030, 0x90cd, 0x90dc, 0xa03b, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xa076, 0x80e0, 0xa079, 0x80cc, 0xa077, 0x4000, 0x70c1, 0x70c4, 0xa0b2, 0x70d0, 0xa0b5, 0xa0b8, 0xa0b3, 0x60c0, 0x90f1, 0x90f4,
+0xa03e, 0x80f0, 0xa07d, 0xa0bc, 0xa03f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0x901a, 0x6030, 0x804d, 0x805c, 0x901b, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0x9026, 0x80a0, 0x9029, 0x808c, 0x9027, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0x901e, 0x80b0, 0x902d, 0x803c, 0x901f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x904a, 0x6030, 0x700d, 0x701c, 0x904b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x9056, 0x7060, 0x9059, 0x704c, 0x9057, 0x4000, 0x7081, 0x7084, 0x9062, 0x7090, 0x9065, 0x9068, 0x9063, 0x60c0, 0x7031, 0x7034,
+0x904e, 0x7070, 0x905d, 0x906c, 0x904f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x9086, 0x6020, 0x9089, 0x600c, 0x9087, 0x4000, 0x6041, 0x6044, 0x9092, 0x6050, 0x9095, 0x9098, 0x9093, 0x6080, 0x90a1, 0x90a4,
+0xc0ea, 0x6030, 0x908d, 0x909c, 0xc0eb, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0x9036, 0x80e0, 0x9039, 0x80cc, 0x9037, 0x4000, 0x70c1, 0x70c4, 0x9072, 0x70d0, 0x9075, 0x9078, 0x9073, 0x60c0, 0x90b1, 0x90b4,
+0xc0ee, 0x80f0, 0x903d, 0x907c, 0xc0ef, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0x800a, 0x6030, 0x700d, 0x701c, 0x800b, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0x8016, 0x7060, 0x8019, 0x704c, 0x8017, 0x4000, 0x7081, 0x7084, 0x8022, 0x7090, 0x8025, 0x8028, 0x8023, 0x60c0, 0x7031, 0x7034,
+0x800e, 0x7070, 0x801d, 0x802c, 0x800f, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x8046, 0x6020, 0x8049, 0x600c, 0x8047, 0x4000, 0x6041, 0x6044, 0x8052, 0x6050, 0x8055, 0x8058, 0x8053, 0x6080, 0x8061, 0x8064,
+0xb0da, 0x6030, 0x804d, 0x805c, 0xb0db, 0x4000, 0x5001, 0x5004, 0x8082, 0x5010, 0x8085, 0x8088, 0x8083, 0x5040, 0x8091, 0x8094,
+0xb0e6, 0x80a0, 0xb0e9, 0x808c, 0xb0e7, 0x4000, 0x70c1, 0x70c4, 0x8032, 0x70d0, 0x8035, 0x8038, 0x8033, 0x60c0, 0x8071, 0x8074,
+0xb0de, 0x80b0, 0xb0ed, 0x803c, 0xb0df, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x7006, 0x6020, 0x7009, 0x600c, 0x7007, 0x4000, 0x6041, 0x6044, 0x7012, 0x6050, 0x7015, 0x7018, 0x7013, 0x6080, 0x7021, 0x7024,
+0xa0ca, 0x6030, 0x700d, 0x701c, 0xa0cb, 0x4000, 0x5001, 0x5004, 0x7042, 0x5010, 0x7045, 0x7048, 0x7043, 0x5040, 0x7051, 0x7054,
+0xa0d6, 0x7060, 0xa0d9, 0x704c, 0xa0d7, 0x4000, 0x7081, 0x7084, 0xa0e2, 0x7090, 0xa0e5, 0xa0e8, 0xa0e3, 0x60c0, 0x7031, 0x7034,
+0xa0ce, 0x7070, 0xa0dd, 0xa0ec, 0xa0cf, 0x4000, 0x5001, 0x5004, 0x6002, 0x5010, 0x6005, 0x6008, 0x6003, 0x5040, 0x6011, 0x6014,
+0x90c6, 0x6020, 0x90c9, 0x600c, 0x90c7, 0x4000, 0x6041, 0x6044, 0x90d2, 0x6050, 0x90d5, 0x90d8, 0x90d3, 0x6080, 0x90e1, 0x90e4,
+0xc0fa, 0x6030, 0x90cd, 0x90dc, 0xc0fb, 0x4000, 0x5001, 0x5004, 0x80c2, 0x5010, 0x80c5, 0x80c8, 0x80c3, 0x5040, 0x80d1, 0x80d4,
+0xb0f6, 0x80e0, 0xb0f9, 0x80cc, 0xb0f7, 0x4000, 0x70c1, 0x70c4, 0xa0f2, 0x70d0, 0xa0f5, 0xa0f8, 0xa0f3, 0x60c0, 0x90f1, 0x90f4,
+0xc0fe, 0x80f0, 0xb0fd, 0xa0fc, 0xc0ff};
+static const uint16_t MDRG2[] = { 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa024, 0x8098, 0x808b, 0x8099, 0xa025, 0x8108, 0x902a, 0x8109,
+0xa026, 0x8038, 0x902b, 0x8039, 0xa027, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa02c, 0x9118, 0x910b, 0x9119, 0xa02d, 0x8148, 0x903a, 0x8149,
+0xa02e, 0x90b8, 0x903b, 0x90b9, 0xa02f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa094, 0x7018, 0x700b, 0x7019, 0xa095, 0x7088, 0xa0a2, 0x7089,
+0xa096, 0x8068, 0xa0a3, 0x8069, 0xa097, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa034, 0x80d8, 0x80cb, 0x80d9, 0xa035, 0x8188, 0xa0aa, 0x8189,
+0xa036, 0x8078, 0xa0ab, 0x8079, 0xa037, 0x6000, 0x7042, 0x6001, 0xa104, 0x7050, 0x7043, 0x7051, 0xa105, 0x6008, 0xa112, 0x6009,
+0xa106, 0xa120, 0xa113, 0xa121, 0xa107, 0x70c0, 0x704a, 0x70c1, 0xa09c, 0x7058, 0x704b, 0x7059, 0xa09d, 0x70c8, 0xa0b2, 0x70c9,
+0xa09e, 0xa128, 0xa0b3, 0xa129, 0xa09f, 0x6040, 0x9142, 0x6041, 0xa10c, 0x9150, 0x9143, 0x9151, 0xa10d, 0x6048, 0xa11a, 0x6049,
+0xa10e, 0xa130, 0xa11b, 0xa131, 0xa10f, 0x81c0, 0x914a, 0x81c1, 0xa03c, 0x9158, 0x914b, 0x9159, 0xa03d, 0x81c8, 0xa0ba, 0x81c9,
+0xa03e, 0xa138, 0xa0bb, 0xa139, 0xa03f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xb0a4, 0x8098, 0x808b, 0x8099, 0xb0a5, 0x8108, 0x906a, 0x8109,
+0xb0a6, 0x8038, 0x906b, 0x8039, 0xb0a7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xb0ac, 0x9198, 0x918b, 0x9199, 0xb0ad, 0x8148, 0x907a, 0x8149,
+0xb0ae, 0x90f8, 0x907b, 0x90f9, 0xb0af, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb114, 0x7018, 0x700b, 0x7019, 0xb115, 0x7088, 0xb122, 0x7089,
+0xb116, 0x8068, 0xb123, 0x8069, 0xb117, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xb0b4, 0x80d8, 0x80cb, 0x80d9, 0xb0b5, 0x8188, 0xb12a, 0x8189,
+0xb0b6, 0x8078, 0xb12b, 0x8079, 0xb0b7, 0x6000, 0x7042, 0x6001, 0xa144, 0x7050, 0x7043, 0x7051, 0xa145, 0x6008, 0xa152, 0x6009,
+0xa146, 0xa160, 0xa153, 0xa161, 0xa147, 0x70c0, 0x704a, 0x70c1, 0xb11c, 0x7058, 0x704b, 0x7059, 0xb11d, 0x70c8, 0xb132, 0x70c9,
+0xb11e, 0xa168, 0xb133, 0xa169, 0xb11f, 0x6040, 0x91c2, 0x6041, 0xa14c, 0x91d0, 0x91c3, 0x91d1, 0xa14d, 0x6048, 0xa15a, 0x6049,
+0xa14e, 0xa170, 0xa15b, 0xa171, 0xa14f, 0x81c0, 0x91ca, 0x81c1, 0xb0bc, 0x91d8, 0x91cb, 0x91d9, 0xb0bd, 0x81c8, 0xb13a, 0x81c9,
+0xb0be, 0xa178, 0xb13b, 0xa179, 0xb0bf, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa064, 0x8098, 0x808b, 0x8099, 0xa065, 0x8108, 0x902a, 0x8109,
+0xa066, 0x8038, 0x902b, 0x8039, 0xa067, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa06c, 0x9118, 0x910b, 0x9119, 0xa06d, 0x8148, 0x903a, 0x8149,
+0xa06e, 0x90b8, 0x903b, 0x90b9, 0xa06f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa0d4, 0x7018, 0x700b, 0x7019, 0xa0d5, 0x7088, 0xa0e2, 0x7089,
+0xa0d6, 0x8068, 0xa0e3, 0x8069, 0xa0d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa074, 0x80d8, 0x80cb, 0x80d9, 0xa075, 0x8188, 0xa0ea, 0x8189,
+0xa076, 0x8078, 0xa0eb, 0x8079, 0xa077, 0x6000, 0x7042, 0x6001, 0xa184, 0x7050, 0x7043, 0x7051, 0xa185, 0x6008, 0xa192, 0x6009,
+0xa186, 0xa1a0, 0xa193, 0xa1a1, 0xa187, 0x70c0, 0x704a, 0x70c1, 0xa0dc, 0x7058, 0x704b, 0x7059, 0xa0dd, 0x70c8, 0xa0f2, 0x70c9,
+0xa0de, 0xa1a8, 0xa0f3, 0xa1a9, 0xa0df, 0x6040, 0x9142, 0x6041, 0xa18c, 0x9150, 0x9143, 0x9151, 0xa18d, 0x6048, 0xa19a, 0x6049,
+0xa18e, 0xa1b0, 0xa19b, 0xa1b1, 0xa18f, 0x81c0, 0x914a, 0x81c1, 0xa07c, 0x9158, 0x914b, 0x9159, 0xa07d, 0x81c8, 0xa0fa, 0x81c9,
+0xa07e, 0xa1b8, 0xa0fb, 0xa1b9, 0xa07f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xc124, 0x8098, 0x808b, 0x8099, 0xc125, 0x8108, 0x906a, 0x8109,
+0xc126, 0x8038, 0x906b, 0x8039, 0xc127, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xc12c, 0x9198, 0x918b, 0x9199, 0xc12d, 0x8148, 0x907a, 0x8149,
+0xc12e, 0x90f8, 0x907b, 0x90f9, 0xc12f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb154, 0x7018, 0x700b, 0x7019, 0xb155, 0x7088, 0xb162, 0x7089,
+0xb156, 0x8068, 0xb163, 0x8069, 0xb157, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xc134, 0x80d8, 0x80cb, 0x80d9, 0xc135, 0x8188, 0xb16a, 0x8189,
+0xc136, 0x8078, 0xb16b, 0x8079, 0xc137, 0x6000, 0x7042, 0x6001, 0xa1c4, 0x7050, 0x7043, 0x7051, 0xa1c5, 0x6008, 0xa1d2, 0x6009,
+0xa1c6, 0xa1e0, 0xa1d3, 0xa1e1, 0xa1c7, 0x70c0, 0x704a, 0x70c1, 0xb15c, 0x7058, 0x704b, 0x7059, 0xb15d, 0x70c8, 0xb172, 0x70c9,
+0xb15e, 0xa1e8, 0xb173, 0xa1e9, 0xb15f, 0x6040, 0x91c2, 0x6041, 0xa1cc, 0x91d0, 0x91c3, 0x91d1, 0xa1cd, 0x6048, 0xa1da, 0x6049,
+0xa1ce, 0xa1f0, 0xa1db, 0xa1f1, 0xa1cf, 0x81c0, 0x91ca, 0x81c1, 0xc13c, 0x91d8, 0x91cb, 0x91d9, 0xc13d, 0x81c8, 0xb17a, 0x81c9,
+0xc13e, 0xa1f8, 0xb17b, 0xa1f9, 0xc13f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa024, 0x8098, 0x808b, 0x8099, 0xa025, 0x8108, 0x902a, 0x8109,
+0xa026, 0x8038, 0x902b, 0x8039, 0xa027, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa02c, 0x9118, 0x910b, 0x9119, 0xa02d, 0x8148, 0x903a, 0x8149,
+0xa02e, 0x90b8, 0x903b, 0x90b9, 0xa02f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa094, 0x7018, 0x700b, 0x7019, 0xa095, 0x7088, 0xa0a2, 0x7089,
+0xa096, 0x8068, 0xa0a3, 0x8069, 0xa097, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa034, 0x80d8, 0x80cb, 0x80d9, 0xa035, 0x8188, 0xa0aa, 0x8189,
+0xa036, 0x8078, 0xa0ab, 0x8079, 0xa037, 0x6000, 0x7042, 0x6001, 0xa104, 0x7050, 0x7043, 0x7051, 0xa105, 0x6008, 0xa112, 0x6009,
+0xa106, 0xa120, 0xa113, 0xa121, 0xa107, 0x70c0, 0x704a, 0x70c1, 0xa09c, 0x7058, 0x704b, 0x7059, 0xa09d, 0x70c8, 0xa0b2, 0x70c9,
+0xa09e, 0xa128, 0xa0b3, 0xa129, 0xa09f, 0x6040, 0x9142, 0x6041, 0xa10c, 0x9150, 0x9143, 0x9151, 0xa10d, 0x6048, 0xa11a, 0x6049,
+0xa10e, 0xa130, 0xa11b, 0xa131, 0xa10f, 0x81c0, 0x914a, 0x81c1, 0xa03c, 0x9158, 0x914b, 0x9159, 0xa03d, 0x81c8, 0xa0ba, 0x81c9,
+0xa03e, 0xa138, 0xa0bb, 0xa139, 0xa03f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xb0e4, 0x8098, 0x808b, 0x8099, 0xb0e5, 0x8108, 0x906a, 0x8109,
+0xb0e6, 0x8038, 0x906b, 0x8039, 0xb0e7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xb0ec, 0x9198, 0x918b, 0x9199, 0xb0ed, 0x8148, 0x907a, 0x8149,
+0xb0ee, 0x90f8, 0x907b, 0x90f9, 0xb0ef, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb194, 0x7018, 0x700b, 0x7019, 0xb195, 0x7088, 0xb1a2, 0x7089,
+0xb196, 0x8068, 0xb1a3, 0x8069, 0xb197, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xb0f4, 0x80d8, 0x80cb, 0x80d9, 0xb0f5, 0x8188, 0xb1aa, 0x8189,
+0xb0f6, 0x8078, 0xb1ab, 0x8079, 0xb0f7, 0x6000, 0x7042, 0x6001, 0xa144, 0x7050, 0x7043, 0x7051, 0xa145, 0x6008, 0xa152, 0x6009,
+0xa146, 0xa160, 0xa153, 0xa161, 0xa147, 0x70c0, 0x704a, 0x70c1, 0xb19c, 0x7058, 0x704b, 0x7059, 0xb19d, 0x70c8, 0xb1b2, 0x70c9,
+0xb19e, 0xa168, 0xb1b3, 0xa169, 0xb19f, 0x6040, 0x91c2, 0x6041, 0xa14c, 0x91d0, 0x91c3, 0x91d1, 0xa14d, 0x6048, 0xa15a, 0x6049,
+0xa14e, 0xa170, 0xa15b, 0xa171, 0xa14f, 0x81c0, 0x91ca, 0x81c1, 0xb0fc, 0x91d8, 0x91cb, 0x91d9, 0xb0fd, 0x81c8, 0xb1ba, 0x81c9,
+0xb0fe, 0xa178, 0xb1bb, 0xa179, 0xb0ff, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa064, 0x8098, 0x808b, 0x8099, 0xa065, 0x8108, 0x902a, 0x8109,
+0xa066, 0x8038, 0x902b, 0x8039, 0xa067, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa06c, 0x9118, 0x910b, 0x9119, 0xa06d, 0x8148, 0x903a, 0x8149,
+0xa06e, 0x90b8, 0x903b, 0x90b9, 0xa06f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa0d4, 0x7018, 0x700b, 0x7019, 0xa0d5, 0x7088, 0xa0e2, 0x7089,
+0xa0d6, 0x8068, 0xa0e3, 0x8069, 0xa0d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa074, 0x80d8, 0x80cb, 0x80d9, 0xa075, 0x8188, 0xa0ea, 0x8189,
+0xa076, 0x8078, 0xa0eb, 0x8079, 0xa077, 0x6000, 0x7042, 0x6001, 0xa184, 0x7050, 0x7043, 0x7051, 0xa185, 0x6008, 0xa192, 0x6009,
+0xa186, 0xa1a0, 0xa193, 0xa1a1, 0xa187, 0x70c0, 0x704a, 0x70c1, 0xa0dc, 0x7058, 0x704b, 0x7059, 0xa0dd, 0x70c8, 0xa0f2, 0x70c9,
+0xa0de, 0xa1a8, 0xa0f3, 0xa1a9, 0xa0df, 0x6040, 0x9142, 0x6041, 0xa18c, 0x9150, 0x9143, 0x9151, 0xa18d, 0x6048, 0xa19a, 0x6049,
+0xa18e, 0xa1b0, 0xa19b, 0xa1b1, 0xa18f, 0x81c0, 0x914a, 0x81c1, 0xa07c, 0x9158, 0x914b, 0x9159, 0xa07d, 0x81c8, 0xa0fa, 0x81c9,
+0xa07e, 0xa1b8, 0xa0fb, 0xa1b9, 0xa07f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xc164, 0x8098, 0x808b, 0x8099, 0xc165, 0x8108, 0x906a, 0x8109,
+0xc166, 0x8038, 0x906b, 0x8039, 0xc167, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xc16c, 0x9198, 0x918b, 0x9199, 0xc16d, 0x8148, 0x907a, 0x8149,
+0xc16e, 0x90f8, 0x907b, 0x90f9, 0xc16f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb1d4, 0x7018, 0x700b, 0x7019, 0xb1d5, 0x7088, 0xb1e2, 0x7089,
+0xb1d6, 0x8068, 0xb1e3, 0x8069, 0xb1d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xc174, 0x80d8, 0x80cb, 0x80d9, 0xc175, 0x8188, 0xb1ea, 0x8189,
+0xc176, 0x8078, 0xb1eb, 0x8079, 0xc177, 0x6000, 0x7042, 0x6001, 0xa1c4, 0x7050, 0x7043, 0x7051, 0xa1c5, 0x6008, 0xa1d2, 0x6009,
+0xa1c6, 0xa1e0, 0xa1d3, 0xa1e1, 0xa1c7, 0x70c0, 0x704a, 0x70c1, 0xb1dc, 0x7058, 0x704b, 0x7059, 0xb1dd, 0x70c8, 0xb1f2, 0x70c9,
+0xb1de, 0xa1e8, 0xb1f3, 0xa1e9, 0xb1df, 0x6040, 0x91c2, 0x6041, 0xa1cc, 0x91d0, 0x91c3, 0x91d1, 0xa1cd, 0x6048, 0xa1da, 0x6049,
+0xa1ce, 0xa1f0, 0xa1db, 0xa1f1, 0xa1cf, 0x81c0, 0x91ca, 0x81c1, 0xc17c, 0x91d8, 0x91cb, 0x91d9, 0xc17d, 0x81c8, 0xb1fa, 0x81c9,
+0xc17e, 0xa1f8, 0xb1fb, 0xa1f9, 0xc17f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa024, 0x8098, 0x808b, 0x8099, 0xa025, 0x8108, 0x902a, 0x8109,
+0xa026, 0x8038, 0x902b, 0x8039, 0xa027, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa02c, 0x9118, 0x910b, 0x9119, 0xa02d, 0x8148, 0x903a, 0x8149,
+0xa02e, 0x90b8, 0x903b, 0x90b9, 0xa02f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa094, 0x7018, 0x700b, 0x7019, 0xa095, 0x7088, 0xa0a2, 0x7089,
+0xa096, 0x8068, 0xa0a3, 0x8069, 0xa097, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa034, 0x80d8, 0x80cb, 0x80d9, 0xa035, 0x8188, 0xa0aa, 0x8189,
+0xa036, 0x8078, 0xa0ab, 0x8079, 0xa037, 0x6000, 0x7042, 0x6001, 0xa104, 0x7050, 0x7043, 0x7051, 0xa105, 0x6008, 0xa112, 0x6009,
+0xa106, 0xa120, 0xa113, 0xa121, 0xa107, 0x70c0, 0x704a, 0x70c1, 0xa09c, 0x7058, 0x704b, 0x7059, 0xa09d, 0x70c8, 0xa0b2, 0x70c9,
+0xa09e, 0xa128, 0xa0b3, 0xa129, 0xa09f, 0x6040, 0x9142, 0x6041, 0xa10c, 0x9150, 0x9143, 0x9151, 0xa10d, 0x6048, 0xa11a, 0x6049,
+0xa10e, 0xa130, 0xa11b, 0xa131, 0xa10f, 0x81c0, 0x914a, 0x81c1, 0xa03c, 0x9158, 0x914b, 0x9159, 0xa03d, 0x81c8, 0xa0ba, 0x81c9,
+0xa03e, 0xa138, 0xa0bb, 0xa139, 0xa03f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xb0a4, 0x8098, 0x808b, 0x8099, 0xb0a5, 0x8108, 0x906a, 0x8109,
+0xb0a6, 0x8038, 0x906b, 0x8039, 0xb0a7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xb0ac, 0x9198, 0x918b, 0x9199, 0xb0ad, 0x8148, 0x907a, 0x8149,
+0xb0ae, 0x90f8, 0x907b, 0x90f9, 0xb0af, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb114, 0x7018, 0x700b, 0x7019, 0xb115, 0x7088, 0xb122, 0x7089,
+0xb116, 0x8068, 0xb123, 0x8069, 0xb117, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xb0b4, 0x80d8, 0x80cb, 0x80d9, 0xb0b5, 0x8188, 0xb12a, 0x8189,
+0xb0b6, 0x8078, 0xb12b, 0x8079, 0xb0b7, 0x6000, 0x7042, 0x6001, 0xa144, 0x7050, 0x7043, 0x7051, 0xa145, 0x6008, 0xa152, 0x6009,
+0xa146, 0xa160, 0xa153, 0xa161, 0xa147, 0x70c0, 0x704a, 0x70c1, 0xb11c, 0x7058, 0x704b, 0x7059, 0xb11d, 0x70c8, 0xb132, 0x70c9,
+0xb11e, 0xa168, 0xb133, 0xa169, 0xb11f, 0x6040, 0x91c2, 0x6041, 0xa14c, 0x91d0, 0x91c3, 0x91d1, 0xa14d, 0x6048, 0xa15a, 0x6049,
+0xa14e, 0xa170, 0xa15b, 0xa171, 0xa14f, 0x81c0, 0x91ca, 0x81c1, 0xb0bc, 0x91d8, 0x91cb, 0x91d9, 0xb0bd, 0x81c8, 0xb13a, 0x81c9,
+0xb0be, 0xa178, 0xb13b, 0xa179, 0xb0bf, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa064, 0x8098, 0x808b, 0x8099, 0xa065, 0x8108, 0x902a, 0x8109,
+0xa066, 0x8038, 0x902b, 0x8039, 0xa067, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa06c, 0x9118, 0x910b, 0x9119, 0xa06d, 0x8148, 0x903a, 0x8149,
+0xa06e, 0x90b8, 0x903b, 0x90b9, 0xa06f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa0d4, 0x7018, 0x700b, 0x7019, 0xa0d5, 0x7088, 0xa0e2, 0x7089,
+0xa0d6, 0x8068, 0xa0e3, 0x8069, 0xa0d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa074, 0x80d8, 0x80cb, 0x80d9, 0xa075, 0x8188, 0xa0ea, 0x8189,
+0xa076, 0x8078, 0xa0eb, 0x8079, 0xa077, 0x6000, 0x7042, 0x6001, 0xa184, 0x7050, 0x7043, 0x7051, 0xa185, 0x6008, 0xa192, 0x6009,
+0xa186, 0xa1a0, 0xa193, 0xa1a1, 0xa187, 0x70c0, 0x704a, 0x70c1, 0xa0dc, 0x7058, 0x704b, 0x7059, 0xa0dd, 0x70c8, 0xa0f2, 0x70c9,
+0xa0de, 0xa1a8, 0xa0f3, 0xa1a9, 0xa0df, 0x6040, 0x9142, 0x6041, 0xa18c, 0x9150, 0x9143, 0x9151, 0xa18d, 0x6048, 0xa19a, 0x6049,
+0xa18e, 0xa1b0, 0xa19b, 0xa1b1, 0xa18f, 0x81c0, 0x914a, 0x81c1, 0xa07c, 0x9158, 0x914b, 0x9159, 0xa07d, 0x81c8, 0xa0fa, 0x81c9,
+0xa07e, 0xa1b8, 0xa0fb, 0xa1b9, 0xa07f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xc1a4, 0x8098, 0x808b, 0x8099, 0xc1a5, 0x8108, 0x906a, 0x8109,
+0xc1a6, 0x8038, 0x906b, 0x8039, 0xc1a7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xc1ac, 0x9198, 0x918b, 0x9199, 0xc1ad, 0x8148, 0x907a, 0x8149,
+0xc1ae, 0x90f8, 0x907b, 0x90f9, 0xc1af, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb154, 0x7018, 0x700b, 0x7019, 0xb155, 0x7088, 0xb162, 0x7089,
+0xb156, 0x8068, 0xb163, 0x8069, 0xb157, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xc1b4, 0x80d8, 0x80cb, 0x80d9, 0xc1b5, 0x8188, 0xb16a, 0x8189,
+0xc1b6, 0x8078, 0xb16b, 0x8079, 0xc1b7, 0x6000, 0x7042, 0x6001, 0xa1c4, 0x7050, 0x7043, 0x7051, 0xa1c5, 0x6008, 0xa1d2, 0x6009,
+0xa1c6, 0xa1e0, 0xa1d3, 0xa1e1, 0xa1c7, 0x70c0, 0x704a, 0x70c1, 0xb15c, 0x7058, 0x704b, 0x7059, 0xb15d, 0x70c8, 0xb172, 0x70c9,
+0xb15e, 0xa1e8, 0xb173, 0xa1e9, 0xb15f, 0x6040, 0x91c2, 0x6041, 0xa1cc, 0x91d0, 0x91c3, 0x91d1, 0xa1cd, 0x6048, 0xa1da, 0x6049,
+0xa1ce, 0xa1f0, 0xa1db, 0xa1f1, 0xa1cf, 0x81c0, 0x91ca, 0x81c1, 0xc1bc, 0x91d8, 0x91cb, 0x91d9, 0xc1bd, 0x81c8, 0xb17a, 0x81c9,
+0xc1be, 0xa1f8, 0xb17b, 0xa1f9, 0xc1bf, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa024, 0x8098, 0x808b, 0x8099, 0xa025, 0x8108, 0x902a, 0x8109,
+0xa026, 0x8038, 0x902b, 0x8039, 0xa027, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa02c, 0x9118, 0x910b, 0x9119, 0xa02d, 0x8148, 0x903a, 0x8149,
+0xa02e, 0x90b8, 0x903b, 0x90b9, 0xa02f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa094, 0x7018, 0x700b, 0x7019, 0xa095, 0x7088, 0xa0a2, 0x7089,
+0xa096, 0x8068, 0xa0a3, 0x8069, 0xa097, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa034, 0x80d8, 0x80cb, 0x80d9, 0xa035, 0x8188, 0xa0aa, 0x8189,
+0xa036, 0x8078, 0xa0ab, 0x8079, 0xa037, 0x6000, 0x7042, 0x6001, 0xa104, 0x7050, 0x7043, 0x7051, 0xa105, 0x6008, 0xa112, 0x6009,
+0xa106, 0xa120, 0xa113, 0xa121, 0xa107, 0x70c0, 0x704a, 0x70c1, 0xa09c, 0x7058, 0x704b, 0x7059, 0xa09d, 0x70c8, 0xa0b2, 0x70c9,
+0xa09e, 0xa128, 0xa0b3, 0xa129, 0xa09f, 0x6040, 0x9142, 0x6041, 0xa10c, 0x9150, 0x9143, 0x9151, 0xa10d, 0x6048, 0xa11a, 0x6049,
+0xa10e, 0xa130, 0xa11b, 0xa131, 0xa10f, 0x81c0, 0x914a, 0x81c1, 0xa03c, 0x9158, 0x914b, 0x9159, 0xa03d, 0x81c8, 0xa0ba, 0x81c9,
+0xa03e, 0xa138, 0xa0bb, 0xa139, 0xa03f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xb0e4, 0x8098, 0x808b, 0x8099, 0xb0e5, 0x8108, 0x906a, 0x8109,
+0xb0e6, 0x8038, 0x906b, 0x8039, 0xb0e7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xb0ec, 0x9198, 0x918b, 0x9199, 0xb0ed, 0x8148, 0x907a, 0x8149,
+0xb0ee, 0x90f8, 0x907b, 0x90f9, 0xb0ef, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb194, 0x7018, 0x700b, 0x7019, 0xb195, 0x7088, 0xb1a2, 0x7089,
+0xb196, 0x8068, 0xb1a3, 0x8069, 0xb197, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xb0f4, 0x80d8, 0x80cb, 0x80d9, 0xb0f5, 0x8188, 0xb1aa, 0x8189,
+0xb0f6, 0x8078, 0xb1ab, 0x8079, 0xb0f7, 0x6000, 0x7042, 0x6001, 0xa144, 0x7050, 0x7043, 0x7051, 0xa145, 0x6008, 0xa152, 0x6009,
+0xa146, 0xa160, 0xa153, 0xa161, 0xa147, 0x70c0, 0x704a, 0x70c1, 0xb19c, 0x7058, 0x704b, 0x7059, 0xb19d, 0x70c8, 0xb1b2, 0x70c9,
+0xb19e, 0xa168, 0xb1b3, 0xa169, 0xb19f, 0x6040, 0x91c2, 0x6041, 0xa14c, 0x91d0, 0x91c3, 0x91d1, 0xa14d, 0x6048, 0xa15a, 0x6049,
+0xa14e, 0xa170, 0xa15b, 0xa171, 0xa14f, 0x81c0, 0x91ca, 0x81c1, 0xb0fc, 0x91d8, 0x91cb, 0x91d9, 0xb0fd, 0x81c8, 0xb1ba, 0x81c9,
+0xb0fe, 0xa178, 0xb1bb, 0xa179, 0xb0ff, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9014, 0x7018, 0x700b, 0x7019, 0x9015, 0x7088, 0x9022, 0x7089,
+0x9016, 0x8028, 0x9023, 0x8029, 0x9017, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xa064, 0x8098, 0x808b, 0x8099, 0xa065, 0x8108, 0x902a, 0x8109,
+0xa066, 0x8038, 0x902b, 0x8039, 0xa067, 0x6000, 0x7042, 0x6001, 0x9084, 0x7050, 0x7043, 0x7051, 0x9085, 0x6008, 0x9092, 0x6009,
+0x9086, 0x90a0, 0x9093, 0x90a1, 0x9087, 0x70c0, 0x704a, 0x70c1, 0x901c, 0x7058, 0x704b, 0x7059, 0x901d, 0x70c8, 0x9032, 0x70c9,
+0x901e, 0x90a8, 0x9033, 0x90a9, 0x901f, 0x6040, 0x9102, 0x6041, 0x908c, 0x9110, 0x9103, 0x9111, 0x908d, 0x6048, 0x909a, 0x6049,
+0x908e, 0x90b0, 0x909b, 0x90b1, 0x908f, 0x8140, 0x910a, 0x8141, 0xa06c, 0x9118, 0x910b, 0x9119, 0xa06d, 0x8148, 0x903a, 0x8149,
+0xa06e, 0x90b8, 0x903b, 0x90b9, 0xa06f, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xa0d4, 0x7018, 0x700b, 0x7019, 0xa0d5, 0x7088, 0xa0e2, 0x7089,
+0xa0d6, 0x8068, 0xa0e3, 0x8069, 0xa0d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xa074, 0x80d8, 0x80cb, 0x80d9, 0xa075, 0x8188, 0xa0ea, 0x8189,
+0xa076, 0x8078, 0xa0eb, 0x8079, 0xa077, 0x6000, 0x7042, 0x6001, 0xa184, 0x7050, 0x7043, 0x7051, 0xa185, 0x6008, 0xa192, 0x6009,
+0xa186, 0xa1a0, 0xa193, 0xa1a1, 0xa187, 0x70c0, 0x704a, 0x70c1, 0xa0dc, 0x7058, 0x704b, 0x7059, 0xa0dd, 0x70c8, 0xa0f2, 0x70c9,
+0xa0de, 0xa1a8, 0xa0f3, 0xa1a9, 0xa0df, 0x6040, 0x9142, 0x6041, 0xa18c, 0x9150, 0x9143, 0x9151, 0xa18d, 0x6048, 0xa19a, 0x6049,
+0xa18e, 0xa1b0, 0xa19b, 0xa1b1, 0xa18f, 0x81c0, 0x914a, 0x81c1, 0xa07c, 0x9158, 0x914b, 0x9159, 0xa07d, 0x81c8, 0xa0fa, 0x81c9,
+0xa07e, 0xa1b8, 0xa0fb, 0xa1b9, 0xa07f, 0x6000, 0x7002, 0x6001, 0x8004, 0x7010, 0x7003, 0x7011, 0x8005, 0x6008, 0x8012, 0x6009,
+0x8006, 0x8020, 0x8013, 0x8021, 0x8007, 0x7080, 0x700a, 0x7081, 0x9054, 0x7018, 0x700b, 0x7019, 0x9055, 0x7088, 0x9062, 0x7089,
+0x9056, 0x8028, 0x9063, 0x8029, 0x9057, 0x6040, 0x8082, 0x6041, 0x800c, 0x8090, 0x8083, 0x8091, 0x800d, 0x6048, 0x801a, 0x6049,
+0x800e, 0x8030, 0x801b, 0x8031, 0x800f, 0x8100, 0x808a, 0x8101, 0xc1e4, 0x8098, 0x808b, 0x8099, 0xc1e5, 0x8108, 0x906a, 0x8109,
+0xc1e6, 0x8038, 0x906b, 0x8039, 0xc1e7, 0x6000, 0x7042, 0x6001, 0x90c4, 0x7050, 0x7043, 0x7051, 0x90c5, 0x6008, 0x90d2, 0x6009,
+0x90c6, 0x90e0, 0x90d3, 0x90e1, 0x90c7, 0x70c0, 0x704a, 0x70c1, 0x905c, 0x7058, 0x704b, 0x7059, 0x905d, 0x70c8, 0x9072, 0x70c9,
+0x905e, 0x90e8, 0x9073, 0x90e9, 0x905f, 0x6040, 0x9182, 0x6041, 0x90cc, 0x9190, 0x9183, 0x9191, 0x90cd, 0x6048, 0x90da, 0x6049,
+0x90ce, 0x90f0, 0x90db, 0x90f1, 0x90cf, 0x8140, 0x918a, 0x8141, 0xc1ec, 0x9198, 0x918b, 0x9199, 0xc1ed, 0x8148, 0x907a, 0x8149,
+0xc1ee, 0x90f8, 0x907b, 0x90f9, 0xc1ef, 0x6000, 0x7002, 0x6001, 0x8044, 0x7010, 0x7003, 0x7011, 0x8045, 0x6008, 0x8052, 0x6009,
+0x8046, 0x8060, 0x8053, 0x8061, 0x8047, 0x7080, 0x700a, 0x7081, 0xb1d4, 0x7018, 0x700b, 0x7019, 0xb1d5, 0x7088, 0xb1e2, 0x7089,
+0xb1d6, 0x8068, 0xb1e3, 0x8069, 0xb1d7, 0x6040, 0x80c2, 0x6041, 0x804c, 0x80d0, 0x80c3, 0x80d1, 0x804d, 0x6048, 0x805a, 0x6049,
+0x804e, 0x8070, 0x805b, 0x8071, 0x804f, 0x8180, 0x80ca, 0x8181, 0xc1f4, 0x80d8, 0x80cb, 0x80d9, 0xc1f5, 0x8188, 0xb1ea, 0x8189,
+0xc1f6, 0x8078, 0xb1eb, 0x8079, 0xc1f7, 0x6000, 0x7042, 0x6001, 0xa1c4, 0x7050, 0x7043, 0x7051, 0xa1c5, 0x6008, 0xa1d2, 0x6009,
+0xa1c6, 0xa1e0, 0xa1d3, 0xa1e1, 0xa1c7, 0x70c0, 0x704a, 0x70c1, 0xb1dc, 0x7058, 0x704b, 0x7059, 0xb1dd, 0x70c8, 0xb1f2, 0x70c9,
+0xb1de, 0xa1e8, 0xb1f3, 0xa1e9, 0xb1df, 0x6040, 0x91c2, 0x6041, 0xa1cc, 0x91d0, 0x91c3, 0x91d1, 0xa1cd, 0x6048, 0xa1da, 0x6049,
+0xa1ce, 0xa1f0, 0xa1db, 0xa1f1, 0xa1cf, 0x81c0, 0x91ca, 0x81c1, 0xc1fc, 0x91d8, 0x91cb, 0x91d9, 0xc1fd, 0x81c8, 0xb1fa, 0x81c9,
+0xc1fe, 0xa1f8, 0xb1fb, 0xa1f9, 0xc1ff};
+static const uint16_t MDRG3[] = { 0x6000, 0x7004, 0x6001, 0x8008, 0x6002, 0x7005, 0x6003, 0x8009, 0x7040, 0x7006, 0x7041,
+0x800a, 0x7042, 0x7007, 0x7043, 0x800b, 0x6010, 0x8044, 0x6011, 0x800c, 0x6012, 0x8045, 0x6013, 0x800d, 0x8080, 0x8046, 0x8081,
+0x800e, 0x8082, 0x8047, 0x8083, 0x800f, 0x6020, 0x7014, 0x6021, 0x9048, 0x6022, 0x7015, 0x6023, 0x9049, 0x7050, 0x7016, 0x7051,
+0x904a, 0x7052, 0x7017, 0x7053, 0x904b, 0x6030, 0x9084, 0x6031, 0x904c, 0x6032, 0x9085, 0x6033, 0x904d, 0x8090, 0x9086, 0x8091,
+0x904e, 0x8092, 0x9087, 0x8093, 0x904f, 0x6000, 0x7024, 0x6001, 0x8018, 0x6002, 0x7025, 0x6003, 0x8019, 0x7060, 0x7026, 0x7061,
+0x801a, 0x7062, 0x7027, 0x7063, 0x801b, 0x6010, 0x8054, 0x6011, 0x801c, 0x6012, 0x8055, 0x6013, 0x801d, 0x80a0, 0x8056, 0x80a1,
+0x801e, 0x80a2, 0x8057, 0x80a3, 0x801f, 0x6020, 0x7034, 0x6021, 0xa088, 0x6022, 0x7035, 0x6023, 0xa089, 0x7070, 0x7036, 0x7071,
+0xa08a, 0x7072, 0x7037, 0x7073, 0xa08b, 0x6030, 0x9094, 0x6031, 0xa08c, 0x6032, 0x9095, 0x6033, 0xa08d, 0x80b0, 0x9096, 0x80b1,
+0xa08e, 0x80b2, 0x9097, 0x80b3, 0xa08f, 0x6000, 0x7004, 0x6001, 0x8028, 0x6002, 0x7005, 0x6003, 0x8029, 0x7040, 0x7006, 0x7041,
+0x802a, 0x7042, 0x7007, 0x7043, 0x802b, 0x6010, 0x8064, 0x6011, 0x802c, 0x6012, 0x8065, 0x6013, 0x802d, 0x80c0, 0x8066, 0x80c1,
+0x802e, 0x80c2, 0x8067, 0x80c3, 0x802f, 0x6020, 0x7014, 0x6021, 0x9058, 0x6022, 0x7015, 0x6023, 0x9059, 0x7050, 0x7016, 0x7051,
+0x905a, 0x7052, 0x7017, 0x7053, 0x905b, 0x6030, 0x90a4, 0x6031, 0x905c, 0x6032, 0x90a5, 0x6033, 0x905d, 0x80d0, 0x90a6, 0x80d1,
+0x905e, 0x80d2, 0x90a7, 0x80d3, 0x905f, 0x6000, 0x7024, 0x6001, 0x8038, 0x6002, 0x7025, 0x6003, 0x8039, 0x7060, 0x7026, 0x7061,
+0x803a, 0x7062, 0x7027, 0x7063, 0x803b, 0x6010, 0x8074, 0x6011, 0x803c, 0x6012, 0x8075, 0x6013, 0x803d, 0x80e0, 0x8076, 0x80e1,
+0x803e, 0x80e2, 0x8077, 0x80e3, 0x803f, 0x6020, 0x7034, 0x6021, 0xa098, 0x6022, 0x7035, 0x6023, 0xa099, 0x7070, 0x7036, 0x7071,
+0xa09a, 0x7072, 0x7037, 0x7073, 0xa09b, 0x6030, 0x90b4, 0x6031, 0xa09c, 0x6032, 0x90b5, 0x6033, 0xa09d, 0x80f0, 0x90b6, 0x80f1,
+0xa09e, 0x80f2, 0x90b7, 0x80f3, 0xa09f, 0x6000, 0x7004, 0x6001, 0x8008, 0x6002, 0x7005, 0x6003, 0x8009, 0x7040, 0x7006, 0x7041,
+0x800a, 0x7042, 0x7007, 0x7043, 0x800b, 0x6010, 0x8044, 0x6011, 0x800c, 0x6012, 0x8045, 0x6013, 0x800d, 0x8080, 0x8046, 0x8081,
+0x800e, 0x8082, 0x8047, 0x8083, 0x800f, 0x6020, 0x7014, 0x6021, 0x9068, 0x6022, 0x7015, 0x6023, 0x9069, 0x7050, 0x7016, 0x7051,
+0x906a, 0x7052, 0x7017, 0x7053, 0x906b, 0x6030, 0x90c4, 0x6031, 0x906c, 0x6032, 0x90c5, 0x6033, 0x906d, 0x8090, 0x90c6, 0x8091,
+0x906e, 0x8092, 0x90c7, 0x8093, 0x906f, 0x6000, 0x7024, 0x6001, 0x8018, 0x6002, 0x7025, 0x6003, 0x8019, 0x7060, 0x7026, 0x7061,
+0x801a, 0x7062, 0x7027, 0x7063, 0x801b, 0x6010, 0x8054, 0x6011, 0x801c, 0x6012, 0x8055, 0x6013, 0x801d, 0x80a0, 0x8056, 0x80a1,
+0x801e, 0x80a2, 0x8057, 0x80a3, 0x801f, 0x6020, 0x7034, 0x6021, 0xa0a8, 0x6022, 0x7035, 0x6023, 0xa0a9, 0x7070, 0x7036, 0x7071,
+0xa0aa, 0x7072, 0x7037, 0x7073, 0xa0ab, 0x6030, 0x90d4, 0x6031, 0xa0ac, 0x6032, 0x90d5, 0x6033, 0xa0ad, 0x80b0, 0x90d6, 0x80b1,
+0xa0ae, 0x80b2, 0x90d7, 0x80b3, 0xa0af, 0x6000, 0x7004, 0x6001, 0x8028, 0x6002, 0x7005, 0x6003, 0x8029, 0x7040, 0x7006, 0x7041,
+0x802a, 0x7042, 0x7007, 0x7043, 0x802b, 0x6010, 0x8064, 0x6011, 0x802c, 0x6012, 0x8065, 0x6013, 0x802d, 0x80c0, 0x8066, 0x80c1,
+0x802e, 0x80c2, 0x8067, 0x80c3, 0x802f, 0x6020, 0x7014, 0x6021, 0x9078, 0x6022, 0x7015, 0x6023, 0x9079, 0x7050, 0x7016, 0x7051,
+0x907a, 0x7052, 0x7017, 0x7053, 0x907b, 0x6030, 0x90e4, 0x6031, 0x907c, 0x6032, 0x90e5, 0x6033, 0x907d, 0x80d0, 0x90e6, 0x80d1,
+0x907e, 0x80d2, 0x90e7, 0x80d3, 0x907f, 0x6000, 0x7024, 0x6001, 0x8038, 0x6002, 0x7025, 0x6003, 0x8039, 0x7060, 0x7026, 0x7061,
+0x803a, 0x7062, 0x7027, 0x7063, 0x803b, 0x6010, 0x8074, 0x6011, 0x803c, 0x6012, 0x8075, 0x6013, 0x803d, 0x80e0, 0x8076, 0x80e1,
+0x803e, 0x80e2, 0x8077, 0x80e3, 0x803f, 0x6020, 0x7034, 0x6021, 0xa0b8, 0x6022, 0x7035, 0x6023, 0xa0b9, 0x7070, 0x7036, 0x7071,
+0xa0ba, 0x7072, 0x7037, 0x7073, 0xa0bb, 0x6030, 0x90f4, 0x6031, 0xa0bc, 0x6032, 0x90f5, 0x6033, 0xa0bd, 0x80f0, 0x90f6, 0x80f1,
+0xa0be, 0x80f2, 0x90f7, 0x80f3, 0xa0bf, 0x6000, 0x7004, 0x6001, 0x8008, 0x6002, 0x7005, 0x6003, 0x8009, 0x7040, 0x7006, 0x7041,
+0x800a, 0x7042, 0x7007, 0x7043, 0x800b, 0x6010, 0x8044, 0x6011, 0x800c, 0x6012, 0x8045, 0x6013, 0x800d, 0x8080, 0x8046, 0x8081,
+0x800e, 0x8082, 0x8047, 0x8083, 0x800f, 0x6020, 0x7014, 0x6021, 0x9048, 0x6022, 0x7015, 0x6023, 0x9049, 0x7050, 0x7016, 0x7051,
+0x904a, 0x7052, 0x7017, 0x7053, 0x904b, 0x6030, 0x9084, 0x6031, 0x904c, 0x6032, 0x9085, 0x6033, 0x904d, 0x8090, 0x9086, 0x8091,
+0x904e, 0x8092, 0x9087, 0x8093, 0x904f, 0x6000, 0x7024, 0x6001, 0x8018, 0x6002, 0x7025, 0x6003, 0x8019, 0x7060, 0x7026, 0x7061,
+0x801a, 0x7062, 0x7027, 0x7063, 0x801b, 0x6010, 0x8054, 0x6011, 0x801c, 0x6012, 0x8055, 0x6013, 0x801d, 0x80a0, 0x8056, 0x80a1,
+0x801e, 0x80a2, 0x8057, 0x80a3, 0x801f, 0x6020, 0x7034, 0x6021, 0xa0c8, 0x6022, 0x7035, 0x6023, 0xa0c9, 0x7070, 0x7036, 0x7071,
+0xa0ca, 0x7072, 0x7037, 0x7073, 0xa0cb, 0x6030, 0x9094, 0x6031, 0xa0cc, 0x6032, 0x9095, 0x6033, 0xa0cd, 0x80b0, 0x9096, 0x80b1,
+0xa0ce, 0x80b2, 0x9097, 0x80b3, 0xa0cf, 0x6000, 0x7004, 0x6001, 0x8028, 0x6002, 0x7005, 0x6003, 0x8029, 0x7040, 0x7006, 0x7041,
+0x802a, 0x7042, 0x7007, 0x7043, 0x802b, 0x6010, 0x8064, 0x6011, 0x802c, 0x6012, 0x8065, 0x6013, 0x802d, 0x80c0, 0x8066, 0x80c1,
+0x802e, 0x80c2, 0x8067, 0x80c3, 0x802f, 0x6020, 0x7014, 0x6021, 0x9058, 0x6022, 0x7015, 0x6023, 0x9059, 0x7050, 0x7016, 0x7051,
+0x905a, 0x7052, 0x7017, 0x7053, 0x905b, 0x6030, 0x90a4, 0x6031, 0x905c, 0x6032, 0x90a5, 0x6033, 0x905d, 0x80d0, 0x90a6, 0x80d1,
+0x905e, 0x80d2, 0x90a7, 0x80d3, 0x905f, 0x6000, 0x7024, 0x6001, 0x8038, 0x6002, 0x7025, 0x6003, 0x8039, 0x7060, 0x7026, 0x7061,
+0x803a, 0x7062, 0x7027, 0x7063, 0x803b, 0x6010, 0x8074, 0x6011, 0x803c, 0x6012, 0x8075, 0x6013, 0x803d, 0x80e0, 0x8076, 0x80e1,
+0x803e, 0x80e2, 0x8077, 0x80e3, 0x803f, 0x6020, 0x7034, 0x6021, 0xa0d8, 0x6022, 0x7035, 0x6023, 0xa0d9, 0x7070, 0x7036, 0x7071,
+0xa0da, 0x7072, 0x7037, 0x7073, 0xa0db, 0x6030, 0x90b4, 0x6031, 0xa0dc, 0x6032, 0x90b5, 0x6033, 0xa0dd, 0x80f0, 0x90b6, 0x80f1,
+0xa0de, 0x80f2, 0x90b7, 0x80f3, 0xa0df, 0x6000, 0x7004, 0x6001, 0x8008, 0x6002, 0x7005, 0x6003, 0x8009, 0x7040, 0x7006, 0x7041,
+0x800a, 0x7042, 0x7007, 0x7043, 0x800b, 0x6010, 0x8044, 0x6011, 0x800c, 0x6012, 0x8045, 0x6013, 0x800d, 0x8080, 0x8046, 0x8081,
+0x800e, 0x8082, 0x8047, 0x8083, 0x800f, 0x6020, 0x7014, 0x6021, 0x9068, 0x6022, 0x7015, 0x6023, 0x9069, 0x7050, 0x7016, 0x7051,
+0x906a, 0x7052, 0x7017, 0x7053, 0x906b, 0x6030, 0x90c4, 0x6031, 0x906c, 0x6032, 0x90c5, 0x6033, 0x906d, 0x8090, 0x90c6, 0x8091,
+0x906e, 0x8092, 0x90c7, 0x8093, 0x906f, 0x6000, 0x7024, 0x6001, 0x8018, 0x6002, 0x7025, 0x6003, 0x8019, 0x7060, 0x7026, 0x7061,
+0x801a, 0x7062, 0x7027, 0x7063, 0x801b, 0x6010, 0x8054, 0x6011, 0x801c, 0x6012, 0x8055, 0x6013, 0x801d, 0x80a0, 0x8056, 0x80a1,
+0x801e, 0x80a2, 0x8057, 0x80a3, 0x801f, 0x6020, 0x7034, 0x6021, 0xa0e8, 0x6022, 0x7035, 0x6023, 0xa0e9, 0x7070, 0x7036, 0x7071,
+0xa0ea, 0x7072, 0x7037, 0x7073, 0xa0eb, 0x6030, 0x90d4, 0x6031, 0xa0ec, 0x6032, 0x90d5, 0x6033, 0xa0ed, 0x80b0, 0x90d6, 0x80b1,
+0xa0ee, 0x80b2, 0x90d7, 0x80b3, 0xa0ef, 0x6000, 0x7004, 0x6001, 0x8028, 0x6002, 0x7005, 0x6003, 0x8029, 0x7040, 0x7006, 0x7041,
+0x802a, 0x7042, 0x7007, 0x7043, 0x802b, 0x6010, 0x8064, 0x6011, 0x802c, 0x6012, 0x8065, 0x6013, 0x802d, 0x80c0, 0x8066, 0x80c1,
+0x802e, 0x80c2, 0x8067, 0x80c3, 0x802f, 0x6020, 0x7014, 0x6021, 0x9078, 0x6022, 0x7015, 0x6023, 0x9079, 0x7050, 0x7016, 0x7051,
+0x907a, 0x7052, 0x7017, 0x7053, 0x907b, 0x6030, 0x90e4, 0x6031, 0x907c, 0x6032, 0x90e5, 0x6033, 0x907d, 0x80d0, 0x90e6, 0x80d1,
+0x907e, 0x80d2, 0x90e7, 0x80d3, 0x907f, 0x6000, 0x7024, 0x6001, 0x8038, 0x6002, 0x7025, 0x6003, 0x8039, 0x7060, 0x7026, 0x7061,
+0x803a, 0x7062, 0x7027, 0x7063, 0x803b, 0x6010, 0x8074, 0x6011, 0x803c, 0x6012, 0x8075, 0x6013, 0x803d, 0x80e0, 0x8076, 0x80e1,
+0x803e, 0x80e2, 0x8077, 0x80e3, 0x803f, 0x6020, 0x7034, 0x6021, 0xa0f8, 0x6022, 0x7035, 0x6023, 0xa0f9, 0x7070, 0x7036, 0x7071,
+0xa0fa, 0x7072, 0x7037, 0x7073, 0xa0fb, 0x6030, 0x90f4, 0x6031, 0xa0fc, 0x6032, 0x90f5, 0x6033, 0xa0fd, 0x80f0, 0x90f6, 0x80f1,
+0xa0fe, 0x80f2, 0x90f7, 0x80f3, 0xa0ff};
 
 // Decoding tables for codeswitch
 static const uint16_t dsw3[] = { 0x3001, 0x4002, 0x3007, 0x5003, 0x3001, 0x4006, 0x3007, 0x5005, 0x3001, 0x4002, 0x3007, 0x5000,
@@ -144,27 +703,72 @@ static const uint16_t dsw6[] = { 0x6001, 0x7009, 0x603f, 0x8011, 0x6002, 0x7037,
 template<typename T> static T smag(T v) { return (v >> 1) ^ (~T(0) * (v & 1)); }
 
 // Computed decode, does not work for rung 0 or 1
-static std::pair<size_t, uint64_t> qb3dsz(uint64_t val, size_t rung) {
+static codeword qb3dsz(uint64_t val, size_t rung) {
     assert(rung > 1);
     uint64_t rbit = 1ull << rung;
     if (0 == (val & 1)) // Short
-        return std::make_pair(rung, (val & (rbit - 1)) >> 1);
+        return { rung, (val & (rbit - 1)) >> 1 };
     uint64_t n = (val >> 1) & 1; // Next bit, long if set
     val = (val >> 2) & (rbit - 1);
-    return std::make_pair(rung + 1 + n,
+    return { static_cast<size_t>(rung + 1 + n),
         (((1 & ~n) * ~0ull)  & (val | (rbit >> 1))) // Nominal
-        + (((1 & n) * ~0ull) & (val | rbit)));    // Long
+        + (((1 & n) * ~0ull) & (val | rbit)) };   // Long
 }
 
 // Decode using tables when possible, works for all rungs
-static std::pair<size_t, uint64_t> qb3dsztbl(uint64_t val, size_t rung) {
+static codeword qb3dsztbl(uint64_t val, size_t rung) {
     if ((sizeof(DRG) / sizeof(*DRG)) > rung) {
         auto code = DRG[rung][val & ((1ull << (rung + 2)) - 1)];
-        return std::make_pair<size_t, uint64_t>(code >> 12, code & TBLMASK);
+        return { static_cast<size_t>(code >> 12), code & TBLMASK };
     }
     return qb3dsz(val, rung);
 }
 
+// Decode a B2 sized group of QB3 codes at rung, starting at bit pos in src, returns the end position
+// The code lengths only depend on their low two bits, so the offsets are found first, as a short
+// dependency chain, after which the values are extracted independently. Codes are read 64 bits at
+// a time, so rung + 9 has to fit and src should have at least 8 bytes past the last code
+template<typename T>
+static size_t hdecode(const uint8_t* src, size_t pos, size_t rung, T* group) {
+    uint64_t offsets[B2];
+    for (size_t i = 0; i < B2; i++) {
+        offsets[i] = pos;
+        auto w = *reinterpret_cast<const uint64_t*>(src + pos / 8) >> (pos % 8);
+        pos += rung + (w & 1) + (w & (w >> 1) & 1);
+    }
+    // Short codes have rung - 1 value bits, nominal ones add the top bit, long ones have rung
+    // bits and add the bit above, as in qb3dsz
+    const uint64_t half = 1ull << (rung - 1);
+#if defined(__AVX2__)
+    const auto one = _mm256_set1_epi64x(1);
+    const auto low = _mm256_set1_epi64x(half - 1);
+    const auto rshift = _mm256_set1_epi64x(rung - 1);
+    for (size_t i = 0; i < B2; i += 4) {
+        auto o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + i));
+        auto w = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(src), _mm256_srli_epi64(o, 3), 1);
+        w = _mm256_srlv_epi64(w, _mm256_and_si256(o, _mm256_set1_epi64x(7)));
+        auto b0 = _mm256_and_si256(w, one);
+        auto b1 = _mm256_and_si256(b0, _mm256_srli_epi64(w, 1));
+        auto m = _mm256_add_epi64(low, _mm256_sllv_epi64(b1, rshift));
+        auto v = _mm256_and_si256(_mm256_srlv_epi64(w, _mm256_add_epi64(one, b0)), m);
+        v = _mm256_or_si256(v, _mm256_sllv_epi64(b0, _mm256_add_epi64(rshift, b1)));
+        alignas(32) uint64_t val[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(val), v);
+        for (size_t j = 0; j < 4; j++)
+            group[i + j] = static_cast<T>(val[j]);
+    }
+#else
+    for (size_t i = 0; i < B2; i++) {
+        auto w = *reinterpret_cast<const uint64_t*>(src + offsets[i] / 8) >> (offsets[i] % 8);
+        auto b0 = w & 1;
+        auto b1 = b0 & (w >> 1);
+        group[i] = static_cast<T>(((w >> (1 + b0)) & (half - 1 + (b1 << (rung - 1))))
+            | ((b0 << (rung - 1)) << b1));
+    }
+#endif
+    return pos;
+}
+
 // Decode a B2 sized group of QB3 values from s and acc
 // Accumulator should be valid and have at least 56 valid bits
 // For rung 0, it works with 17bits or more
@@ -176,6 +780,12 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
         || ((rung == 1) && (abits <= 17)) // B2 + 1
         || ((rung == 0) && (abits <= 47))); // 3 * B2 - 1
     if (0 == rung) { // single bits, direct decoding
+#if defined(__BMI2__)
+        // All-zero flag, then 16 single bits, or nothing
+        auto flag = acc & 1;
+        unbitplane(group, (acc >> 1) & (0 - flag));
+        abits += B2 & (0 - flag);
+#else
         if (0 != (acc & 1)) {
             abits += B2;
             for (size_t i = 0; i < B2; i++) {
@@ -186,41 +796,65 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
         else
             for (size_t i = 0; i < B2; i++)
                 group[i] = static_cast<T>(0);
+#endif
         s.advance(abits + 1);
         return 1;
     }
     // Table decoding
     if (sizeof(T) == 1 || rung < (sizeof(DRG) / sizeof(*DRG))) {
-        if (1 == rung) { // double barrel
-            for (size_t i = 0; i < B2; i += 2) {
-                auto v = DDRG1[acc & 0x3f];
+        if (1 == rung) { // Four values per lookup
+            for (size_t i = 0; i < B2; i += 4) {
+                auto v = MDRG1[acc & 0xfff];
                 group[i] = v & 0x3;
                 group[i + 1] = (v >> 2) & 0x3;
-                abits += v >> 4;
-                acc >>= v >> 4;
+                group[i + 2] = (v >> 4) & 0x3;
+                group[i + 3] = (v >> 6) & 0x3;
+                abits += v >> 12;
+                acc >>= v >> 12;
             }
             s.advance(abits);
         }
-        else if (2 == rung) { // double barrel, max sym len is 4, there are at least 14 in the accumulator
-            for (size_t i = 0; i < 14; i += 2) {
-                auto v = DDRG2[acc & 0xff];
+        else if (2 == rung) { // Three values per lookup, max sym len is 4, there are at least 12 in the accumulator
+            for (size_t i = 0; i < 12; i += 3) {
+                auto v = MDRG2[acc & 0xfff];
                 group[i] = v & 0x7;
                 group[i + 1] = (v >> 3) & 0x7;
+                group[i + 2] = (v >> 6) & 0x7;
                 abits += v >> 12;
                 acc >>= v >> 12;
             }
-            if (abits > 56) { // Rare
+            if (abits > 48) { // Rare, the last four might not fit
                 s.advance(abits);
                 acc = s.peek();
                 abits = 0;
             }
-            // last pair
-            auto v = DDRG2[acc & 0xff];
-            group[14] = v & 0x7;
-            group[15] = (v >> 3) & 0x7;
+            auto v = MDRG2[acc & 0xfff];
+            group[12] = v & 0x7;
+            group[13] = (v >> 3) & 0x7;
+            group[14] = (v >> 6) & 0x7;
+            abits += v >> 12;
+            acc >>= v >> 12;
+            // last one
+            v = DRG[2][acc & 0xf];
+            group[15] = v & 0x7;
             s.advance(abits + (v >> 12));
         }
-        else if (6 > rung) { // Table decode at 3,4 and 5, half of the values per accumulator
+        else if (3 == rung) { // Two values per lookup, half of the values per accumulator
+            for (size_t j = 0; j < B2; j += B2 / 2) {
+                for (size_t i = j; i < j + B2 / 2; i += 2) {
+                    auto v = MDRG3[acc & 0x3ff];
+                    group[i] = v & 0xf;
+                    group[i + 1] = (v >> 4) & 0xf;
+                    abits += v >> 12;
+                    acc >>= v >> 12;
+                }
+                s.advance(abits);
+                abits = 0;
+                if (0 == j) // Skip the last peek
+                    acc = s.peek();
+            }
+        }
+        else if (6 > rung) { // Table decode at 4 and 5, half of the values per accumulator
             auto drg = DRG[rung];
             const auto m = (1ull << (rung + 2)) - 1;
             for (size_t i = 0; i < B2 / 2; i++) {
@@ -257,6 +891,10 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
             }
         }
     }
+    else if (rung + 9 <= 64 && s.avail() >= abits + B2 * (rung + 2) + 64) { // Directly from memory
+        auto pos = s.position() % 8 + abits;
+        s.advance(abits + hdecode(s.data(), pos, rung, group) - pos);
+    }
     else { // computed decoding
         if (sizeof(T) < 8 || rung < 32) { // 16 and 32 bits may reuse accumulator
             for (int i = 0; i < B2; i++) {
@@ -266,9 +904,9 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
                     abits = 0;
                 }
                 auto p = qb3dsz(acc, rung);
-                abits += p.first;
-                acc >>= p.first;
-                group[i] = static_cast<T>(p.second);
+                abits += p.len;
+                acc >>= p.len;
+                group[i] = static_cast<T>(p.val);
             }
             s.advance(abits);
         }
@@ -276,17 +914,17 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
             s.advance(abits);
             for (int i = 0; i < B2; i++) {
                 auto p = qb3dsz(s.peek(), rung);
-                group[i] = static_cast<T>(p.second);
-                s.advance(p.first);
+                group[i] = static_cast<T>(p.val);
+                s.advance(p.len);
             }
         }
         else { // Rung 63 might need 65 bits
             s.advance(abits);
             for (int i = 0; i < B2; i++) {
                 auto p = qb3dsz(s.peek(), rung);
-                auto ovf = p.first & (p.first >> 6);
-                group[i] = static_cast<T>(p.second);
-                s.advance(p.first ^ ovf);
+                auto ovf = p.len & (p.len >> 6);
+                group[i] = static_cast<T>(p.val);
+                s.advance(p.len ^ ovf);
                 if (ovf) // The next to top bit got dropped, rare
                     group[i] |= s.get() << 62;
             }
@@ -300,17 +938,59 @@ static bool gdecode(iBits& s, size_t rung, T* group, uint64_t acc, size_t abits)
     return true;
 }
 
-// Absolute from mag-sign
-template<typename T> static T magsabs(T v) { return (v >> 1) + (v & 1); }
-
 // Multiply v(in magsign) by m(normal, positive)
 template<typename T> static T magsmul(T v, T m) { return magsabs(v) * (m << 1) - (v & 1); }
 
-// reports most but not all errors, for example if the input stream is too short for the last block
-template<typename T>
-static bool decode(uint8_t *src, size_t len, T* image, const decs &info)
+namespace { // Built for more than one instruction set, keep it local
+// Multiplies the decoded values by the quanta, values which overflow saturate
+// For signed types the comparisons are done with the sign bit flipped, which keeps the order
+template<typename T> struct dequantizer {
+    static constexpr bool identity = false;
+
+    dequantizer(size_t quanta, bool sign) : q(static_cast<T>(quanta)),
+        flip(sign ? static_cast<T>(T(1) << (8 * sizeof(T) - 1)) : T(0)),
+        hi(static_cast<T>(~flip)), lo(flip)
+    {
+        // Largest and smallest values which don't overflow, as signed or unsigned
+        top = static_cast<T>(static_cast<T>(hi / q) ^ flip);
+        // Negative values only overflow if q > 2
+        bottom = (sign && quanta > 2) ? static_cast<T>(static_cast<T>(T(0) - flip / q) ^ flip) : T(0);
+    }
+
+    // Without branches, so it can be vectorized
+    T operator()(T v) const {
+        // Avoid the promotion to signed int for the small types
+        typedef typename std::conditional<sizeof(T) < 4, uint32_t, T>::type P;
+        T f = v ^ flip;
+        v = static_cast<T>(static_cast<P>(v) * static_cast<P>(q));
+        v = f > top ? hi : v;
+        return f < bottom ? lo : v;
+    }
+
+private:
+    T q, flip;
+    T hi, lo; // Type limits
+    T top, bottom; // Range which doesn't overflow, with the sign bit flipped
+};
+} // namespace
+
+// Block offsets within a group, based on traversal order, defaults to HILBERT
+static void block_offsets(uint64_t order, size_t stride, size_t bands, size_t offset[B2]) {
+    order = order ? order : HILBERT;
+    for (size_t i = 0; i < B2; i++) {
+        size_t n = (order >> ((B2 - 1 - i) << 2));
+        offset[i] = ((n >> 2) & 0b11) * stride + (n & 0b11) * bands;
+    }
+}
+
+// Decode a single row of blocks, B lines starting at image, using and updating the band state
+// The values are passed through store after the band delta, while the lines are still in cache
+// Returns true if an error is detected
+template<typename T, typename L = raw<T>>
+static bool decode_row(iBits& s, T* image, size_t stride, const size_t offset[B2], const decs &info, band_state *state,
+    const L& store = L())
 {
-    auto xsize(info.xsize), ysize(info.ysize), bands(info.nbands), stride(info.stride);
+    auto xsize(info.xsize), bands(info.nbands);
     auto cband = info.cband;
     static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "Only unsigned integer types allowed");
     constexpr size_t UBITS(sizeof(T) == 1 ? 3 : sizeof(T) == 2 ? 4 : sizeof(T) == 4 ? 5 : 6);
@@ -319,149 +999,198 @@ static bool decode(uint8_t *src, size_t len, T* image, const decs &info)
     T prev[QB3_MAXBANDS] = {}, pcf[QB3_MAXBANDS] = {}, group[B2] = {};
     size_t runbits[QB3_MAXBANDS] = {};
     const uint16_t* dsw = sizeof(T) == 1 ? dsw3 : sizeof(T) == 2 ? dsw4 : sizeof(T) == 4 ? dsw5 : dsw6;
-    stride = stride ? stride : xsize * bands;
-    // Set up block offsets based on traversal order, defaults to HILBERT
-    uint64_t order(info.order);
-    order = order ? order : HILBERT;
-    size_t offset[B2] = {};
-    for (size_t i = 0; i < B2; i++) {
-        size_t n = (order >> ((B2 - 1 - i) << 2));
-        offset[i] = ((n >> 2) & 0b11) * stride + (n & 0b11) * bands;
+    for (size_t c = 0; c < bands; c++) {
+        prev[c] = static_cast<T>(state[c].prev);
+        pcf[c] = static_cast<T>(state[c].cf);
+        runbits[c] = state[c].runbits;
     }
-    iBits s(src, len);
     bool failed(false);
-    for (size_t y = 0; y < ysize; y += B) {
-        // If the last row is partial, roll it up
-        if (y + B > ysize)
-            y = ysize - B;
-        for (size_t x = 0; x < xsize; x += B) {
-            // If the last column is partial, move it left
-            if (x + B > xsize)
-                x = xsize - B;
-            for (int c = 0; c < bands; c++) {
-                failed |= s.empty();
-                uint64_t cs(0), abits(1), acc(s.peek());
-                if (acc & 1) { // Rung change
-                    cs = dsw[(acc >> 1) & LONG_MASK];
-                    abits = cs >> 12;
-                }
-                acc >>= abits;
-                if (0 == cs || 0 != (cs & TBLMASK)) { // Normal decoding, not a signal
-                    // abits is never > 8, so it's safe to call gdecode
-                    auto rung = (runbits[c] + cs) & NORM_MASK;
-                    failed |= !gdecode(s, rung, group, acc, abits);
-                    runbits[c] = rung;
-                }
-                else { // extra encoding
-                    cs = dsw[acc & LONG_MASK]; // rung, no flag
-                    auto rung = (runbits[c] + cs) & NORM_MASK;
-                    acc >>= (cs >> 12) - 1; // No flag
-                    abits += (cs >> 12) - 1;
-                    if (rung != NORM_MASK) { // CF encoding
-                        auto cfrung(rung);
-                        T cf = pcf[c];
-                        auto read_cfr = acc & 1;
+    for (size_t x = 0; x < xsize; x += B) {
+        // If the last column is partial, move it left
+        if (x + B > xsize)
+            x = xsize - B;
+        for (int c = 0; c < bands; c++) {
+            failed |= s.empty();
+            uint64_t cs(0), abits(1), acc(s.peek());
+            if (acc & 1) { // Rung change
+                cs = dsw[(acc >> 1) & LONG_MASK];
+                abits = cs >> 12;
+            }
+            acc >>= abits;
+            if (0 == cs || 0 != (cs & TBLMASK)) { // Normal decoding, not a signal
+                // abits is never > 8, so it's safe to call gdecode
+                auto rung = (runbits[c] + cs) & NORM_MASK;
+                failed |= !gdecode(s, rung, group, acc, abits);
+                runbits[c] = rung;
+            }
+            else { // extra encoding
+                cs = dsw[acc & LONG_MASK]; // rung, no flag
+                auto rung = (runbits[c] + cs) & NORM_MASK;
+                acc >>= (cs >> 12) - 1; // No flag
+                abits += (cs >> 12) - 1;
+                if (rung != NORM_MASK) { // CF encoding
+                    auto cfrung(rung);
+                    T cf = pcf[c];
+                    auto read_cfr = acc & 1;
+                    abits++;
+                    acc >>= 1;
+                    if (read_cfr) { // different cf, need to read it
+                        read_cfr = acc & 1;
                         abits++;
                         acc >>= 1;
-                        if (read_cfr) { // different cf, need to read it
-                            read_cfr = acc & 1;
-                            abits++;
-                            acc >>= 1;
-                            if (read_cfr) { // has own rung
-                                cs = dsw[acc & LONG_MASK];
-                                cfrung = (rung + cs) & NORM_MASK;
-                                failed |= (cfrung == rung);
-                                acc >>= (cs >> 12) - 1;
-                                abits += (cs >> 12) - 1;
-                            }
-                            if (sizeof(T) == 8 && (cfrung + abits) > 62) { // Rare
-                                s.advance(abits);
-                                acc = s.peek();
-                                abits = 0;
-                            }
-                            auto p = qb3dsztbl(acc, cfrung - read_cfr);
-                            pcf[c] = cf = static_cast<T>(p.second + (read_cfr << cfrung));
-                            abits += p.first;
-                            acc >>= p.first;
+                        if (read_cfr) { // has own rung
+                            cs = dsw[acc & LONG_MASK];
+                            cfrung = (rung + cs) & NORM_MASK;
+                            failed |= (cfrung == rung);
+                            acc >>= (cs >> 12) - 1;
+                            abits += (cs >> 12) - 1;
                         }
-                        cf += 2; // Use it unbiased
-                        if (rung) {
+                        if (sizeof(T) == 8 && (cfrung + abits) > 62) { // Rare
                             s.advance(abits);
-                            failed |= !gdecode(s, rung, group, s.peek(), 0);
-                            // Multiply group by CF and get the max for the actual rung
-                            T maxval(group[0] = magsmul(group[0], cf));
-                            for (int i = 1; i < B2; i++) {
-                                auto val = magsmul(group[i], cf);
-                                if (maxval < val) maxval = val;
-                                group[i] = val;
-                            }
-                            failed |= cf > maxval; // Can't be all zero
-                            runbits[c] = topbit(maxval | 1);
-                        }
-                        else { // Single bit for data, decode here
-                            if (abits + B2 > 64) {
-                                s.advance(abits);
-                                acc = s.peek();
-                                abits = 0;
-                            }
-                            T v[2] = { 0, magsmul(T(1), cf) };
-                            for (int i = 0; i < B2; i++)
-                                group[i] = v[(acc >> i) & 1];
-                            s.advance(B2 + abits);
-                            runbits[c] = topbit(v[1]);
+                            acc = s.peek();
+                            abits = 0;
                         }
+                        auto p = qb3dsztbl(acc, cfrung - read_cfr);
+                        pcf[c] = cf = static_cast<T>(p.val + (read_cfr << cfrung));
+                        abits += p.len;
+                        acc >>= p.len;
                     }
-                    else { // IDX decoding
-                        cs = dsw[acc & LONG_MASK]; // rung, no flag
-                        rung = (runbits[c] + cs) & NORM_MASK;
-                        runbits[c] = rung;
-                        acc >>= (cs >> 12) - 1; // No flag
-                        abits += (cs >> 12) - 1;
-                        failed |= rung == 63; // TODO: Deal with 64bit overflow
-                        // 16 index values in group, max is 7
-                        T maxval(0);
-                        for (int i = 0; i < B2; i++) {
-                            // Could use ddrg2
-                            auto v = DRG[2][acc & 0xf];
-                            group[i] = static_cast<uint8_t>(v);
-                            if (maxval < group[i])
-                                maxval = group[i];
-                            acc >>= v >> 12;
-                            abits += v >> 12;
-                        }
+                    cf += 2; // Use it unbiased
+                    if (rung) {
                         s.advance(abits);
-                        T idxarray[B2 / 2] = {};
-                        for (size_t i = 0; i <= maxval; i++) {
+                        failed |= !gdecode(s, rung, group, s.peek(), 0);
+                        // Multiply group by CF and get the max for the actual rung
+                        T maxval(group[0] = magsmul(group[0], cf));
+                        for (int i = 1; i < B2; i++) {
+                            auto val = magsmul(group[i], cf);
+                            if (maxval < val) maxval = val;
+                            group[i] = val;
+                        }
+                        failed |= cf > maxval; // Can't be all zero
+                        runbits[c] = topbit(maxval | 1);
+                    }
+                    else { // Single bit for data, decode here
+                        if (abits + B2 > 64) {
+                            s.advance(abits);
                             acc = s.peek();
-                            auto v = qb3dsztbl(acc, rung);
-                            s.advance(v.first);
-                            idxarray[i] = T(v.second);
+                            abits = 0;
                         }
+                        T v[2] = { 0, magsmul(T(1), cf) };
                         for (int i = 0; i < B2; i++)
-                            group[i] = idxarray[group[i]];
+                            group[i] = v[(acc >> i) & 1];
+                        s.advance(B2 + abits);
+                        runbits[c] = topbit(v[1]);
                     }
                 }
-                // Undo delta encoding for this block
-                auto prv = prev[c];
-                T* const blockp = image + y * stride + x * bands + c;
-                for (int i = 0; i < B2; i++)
-                    blockp[offset[i]] = prv += smag(group[i]);
-                prev[c] = prv;
-            } // Per band per block
-            if (failed) break;
-        } // per block
-        if (failed) break;
-        // For performance apply band delta per block strip, in linear order
-        for (size_t j = 0; j < B; j++) {
-            for (int c = 0; c < bands; c++) if (c != cband[c]) {
-                auto dimg = image + stride * (y + j) + c;
-                auto simg = image + stride * (y + j) + cband[c];
-                for (int i = 0; i < xsize; i++, dimg += bands, simg += bands)
-                    *dimg += *simg;
+                else { // IDX decoding
+                    cs = dsw[acc & LONG_MASK]; // rung, no flag
+                    rung = (runbits[c] + cs) & NORM_MASK;
+                    runbits[c] = rung;
+                    acc >>= (cs >> 12) - 1; // No flag
+                    abits += (cs >> 12) - 1;
+                    failed |= rung == 63; // TODO: Deal with 64bit overflow
+                    // 16 index values in group, max is 7
+                    T maxval(0);
+                    for (int i = 0; i < B2; i++) {
+                        // Could use ddrg2
+                        auto v = DRG[2][acc & 0xf];
+                        group[i] = static_cast<uint8_t>(v);
+                        if (maxval < group[i])
+                            maxval = group[i];
+                        acc >>= v >> 12;
+                        abits += v >> 12;
+                    }
+                    s.advance(abits);
+                    T idxarray[B2 / 2] = {};
+                    for (size_t i = 0; i <= maxval; i++) {
+                        acc = s.peek();
+                        auto v = qb3dsztbl(acc, rung);
+                        s.advance(v.len);
+                        idxarray[i] = T(v.val);
+                    }
+                    for (int i = 0; i < B2; i++)
+                        group[i] = idxarray[group[i]];
+                }
             }
+            // Undo delta encoding for this block
+            auto prv = prev[c];
+            T* const blockp = image + x * bands + c;
+            for (int i = 0; i < B2; i++)
+                blockp[offset[i]] = prv += smag(group[i]);
+            prev[c] = prv;
+        } // Per band per block
+        if (failed) break;
+    } // per block
+    if (failed)
+        return failed;
+    // For performance apply band delta per block strip, in linear order
+    for (size_t j = 0; j < B; j++) {
+        for (int c = 0; c < bands; c++) if (c != cband[c]) {
+            auto dimg = image + stride * j + c;
+            auto simg = image + stride * j + cband[c];
+            for (int i = 0; i < xsize; i++, dimg += bands, simg += bands)
+                *dimg += *simg;
+        }
+        if (!L::identity) {
+            auto line = image + stride * j;
+            for (size_t i = 0; i < xsize * bands; i++)
+                line[i] = store(line[i]);
         }
-    } // per block strip
+    }
+    for (size_t c = 0; c < bands; c++) {
+        state[c].prev = static_cast<size_t>(prev[c]);
+        state[c].cf = static_cast<size_t>(pcf[c]);
+        state[c].runbits = runbits[c];
+    }
+    return failed;
+}
+
+// reports most but not all errors, for example if the input stream is too short for the last block
+template<typename T, typename L = raw<T>>
+static bool decode(uint8_t *src, size_t len, T* image, const decs &info, const L& store = L())
+{
+    auto stride = info.stride ? info.stride : info.xsize * info.nbands;
+    size_t offset[B2] = {};
+    block_offsets(info.order, stride, info.nbands, offset);
+    band_state state[QB3_MAXBANDS] = {};
+    iBits s(src, len);
+    bool failed(false);
+    for (size_t y = 0; y < info.ysize && !failed; y += B) {
+        // If the last row is partial, roll it up
+        if (y + B > info.ysize)
+            y = info.ysize - B;
+        failed = decode_row(s, image + y * stride, stride, offset, info, state, store);
+    }
     // It might not catch all errors
     return failed || s.avail() > 7; 
 }
+
+// Decode the image lines [y0, y1) of a strip which starts at image line top, columns [x0, x0 + w)
+// Decodes one row of blocks at a time into buffer, which holds B lines, stops after the last needed line
+template<typename T, typename L = raw<T>>
+static bool decode_window(uint8_t* src, size_t len, const decs& info, size_t top,
+    size_t y0, size_t y1, size_t x0, size_t w, T* dest, size_t stride, T* buffer, const L& store = L())
+{
+    auto linesize = info.xsize * info.nbands;
+    size_t offset[B2] = {};
+    block_offsets(info.order, linesize, info.nbands, offset);
+    band_state state[QB3_MAXBANDS] = {};
+    iBits s(src, len);
+    for (size_t y = 0; y < info.ysize; y += B) {
+        // If the last row is partial, roll it up
+        if (y + B > info.ysize)
+            y = info.ysize - B;
+        if (decode_row(s, buffer, linesize, offset, info, state, store))
+            return true;
+        for (size_t j = 0; j < B; j++) {
+            auto line = top + y + j;
+            if (line >= y0 && line < y1)
+                memcpy(dest + (line - y0) * stride, buffer + j * linesize + x0 * info.nbands,
+                    w * info.nbands * sizeof(T));
+        }
+        if (top + y + B >= y1)
+            break;
+    }
+    return false;
+}
 } // namespace
@@ -16,12 +16,15 @@ Contributors:  Lucian Plesea
 */
 
 #pragma warning(disable:4127) // conditional expression is constant
-#include "QB3encode.h"
+#include "QB3common.h"
 #include <limits>
 #include <vector>
 // For memcpy
 #include <cstring>
 
+// Abandons the incremental encoding, if any
+static void drop_stream(encsp p);
+
 // constructor
 encsp qb3_create_encoder(size_t width, size_t height, size_t bands, qb3_dtype dt) {
     if (width < 4 || width > 0x10000ul 
@@ -37,8 +40,13 @@ encsp qb3_create_encoder(size_t width, size_t height, size_t bands, qb3_dtype dt
     p->type = static_cast<qb3_dtype>(dt);
     p->quanta = 1; // No quantization
     p->away = false; // Round to zero
-    //p->raw = false;  // Write image header
+    p->raw = false;  // Write image header
+    p->adaptive = false;
     p->mode = QB3M_DEFAULT; // Fast
+    p->strip = 0; // Single strip
+    p->threads = 1;
+    p->kernels = qb3_select_kernels();
+    p->stream = nullptr;
     // Start with no inter-band differential
     for (size_t c = 0; c < bands; c++) {
         p->band[c].runbits = 0;
@@ -54,6 +62,7 @@ encsp qb3_create_encoder(size_t width, size_t height, size_t bands, qb3_dtype dt
 }
 
 void qb3_reset_encoder(encsp p) {
+    drop_stream(p);
     for (size_t c = 0; c < p->nbands; c++) {
         p->band[c].runbits = 0;
         p->band[c].prev = 0;
@@ -64,6 +73,7 @@ void qb3_reset_encoder(encsp p) {
 }
 
 void qb3_destroy_encoder(encsp p) {
+    drop_stream(p);
     delete p;
 }
 
@@ -124,12 +134,49 @@ bool qb3_set_encoder_quanta(encsp p, size_t q, bool away) {
 // bytes per value by qb3_dtype, keep them in sync
 const int typesizes[8] = { 1, 1, 2, 2, 4, 4, 8, 8 };
 
-size_t qb3_max_encoded_size(const encsp p) {
+// Extra space reserved for each strip, covers the byte alignment and the initial rung switch
+constexpr size_t STRIP_PAD(64);
+
+// Upper bound of encoded data size for a number of lines, in bytes
+static size_t max_data_size(const encsp p, size_t lines) {
     // Pad to 4 x 4
-    size_t nvalues = 16 * ((p->xsize + 3) / 4) * ((p->ysize + 3) / 4) * p->nbands;
+    size_t nvalues = 16 * ((p->xsize + 3) / 4) * ((lines + 3) / 4) * p->nbands;
     // Maximum expansion is under 17/16 bits per input value, for large number of values
     double bits_per_value = 17.0 / 16.0 + typesizes[static_cast<int>(p->type)] * 8;
-    return 1024 + static_cast<size_t>(bits_per_value * nvalues / 8);
+    return static_cast<size_t>(bits_per_value * nvalues / 8);
+}
+
+size_t qb3_max_encoded_size(const encsp p) {
+    size_t sz = 1024 + max_data_size(p, p->ysize);
+    if (p->strip) { // Strip index and per strip padding
+        auto nstrips = strip_count(p->ysize, p->strip);
+        sz += 6 + nstrips * (4 + STRIP_PAD);
+    }
+    return sz;
+}
+
+size_t qb3_set_encoder_strips(encsp p, size_t rows) {
+    size_t brows = (p->ysize + B - 1) / B;
+    if (rows >= brows || p->raw) // Single strip
+        rows = 0;
+    // Use taller strips if there would be too many
+    if (strip_count(p->ysize, rows) > QB3_MAXSTRIPS)
+        rows = (brows + QB3_MAXSTRIPS - 1) / QB3_MAXSTRIPS;
+    p->strip = rows;
+    return rows;
+}
+
+void qb3_set_encoder_raw(encsp p) {
+    p->raw = true;
+    p->strip = 0; // There is no strip index
+}
+
+void qb3_set_encoder_adaptive(encsp p, bool adaptive) {
+    p->adaptive = adaptive;
+}
+
+void qb3_set_encoder_threads(encsp p, size_t threads) {
+    p->threads = threads;
 }
 
 qb3_mode qb3_set_encoder_mode(encsp p, qb3_mode mode) {
@@ -147,69 +194,17 @@ qb3_mode qb3_set_encoder_mode(encsp p, qb3_mode mode) {
     return p->mode;
 }
 
-// Round to Zero Division, no overflow
-template<typename T> static
-T rounddiv(T n, T d) {
-    T m = n % d;
-    T h = d / 2;
-    return n / d + (!(n < 0) & (m > h)) - ((n < 0) & ((m + h) < 0));
-}
-
-// Round from Zero Division, no overflow
-template<typename T> static
-T rounddiv_away(T n, T d) {
-    T m = n % d;
-    T h = d / 2 + d % 2;
-    return n / d + (!(n < 0) & (m >= h)) - ((n < 0) & ((m + h) <= 0));
-}
-
-// Quantize source, in place. T may be signed, q is positive
-template<typename T> static
-bool quantize(T* source, oBits& , encs& p) {
-    size_t nV = p.xsize * p.ysize * p.nbands; // Number of values
-    T q = static_cast<T>(p.quanta);
-    // Optimized versions have to preserve the sign of the input
-    if (2 == q) { // Easy to optimize for 2, common
-        if (p.away)
-            for (size_t i = 0; i < nV; i++)
-                source[i] = source[i] / T(2) + source[i] % T(2);
-        else
-            for (size_t i = 0; i < nV; i++)
-                source[i] /= T(2);
-    }
-    else if (3 == q) {
-        for (size_t i = 0; i < nV; i++)
-            source[i] = source[i] / T(3) + (source[i] % T(3)) / T(2);
-    }
-    else if (4 == q) {
-        if (p.away)
-            for (size_t i = 0; i < nV; i++)
-                source[i] = source[i] / T(4) + (source[i] % T(4)) / T(2);
-        else
-            for (size_t i = 0; i < nV; i++)
-                source[i] = source[i] / T(4) + (source[i] % T(4)) / T(3);
-    }
-    // General case
-    else if (p.away) {
-        for (size_t i = 0; i < nV; i++)
-            source[i] = rounddiv_away(source[i], q);
-    }
-    else {
-        for (size_t i = 0; i < nV; i++)
-            source[i] = rounddiv(source[i], q);
-    }
-    return false;
-}
-
 // A chunk signature is two characters
-void static push_sig(const char* sig, oBits& s) {
+template<typename S>
+void static push_sig(const char* sig, S& s) {
     s.tobyte(); // Always at byte boundary
     s.push(*reinterpret_cast<const uint16_t *>(sig), 16);
 }
 
 // Main header, fixed size
 // 
-void static write_qb3_header(encsp p, oBits& s) {
+template<typename S>
+void static write_qb3_header(encsp p, S& s) {
     // QB3 signature is 4 bytes
     s.push(*reinterpret_cast<const uint32_t*>("QB3\200"), 32);
     // Write xmax, ymax, num bands in low endian
@@ -238,7 +233,8 @@ bool static is_banddiff(encsp p) {
 
 
 // Header for cbands, does nothing if not needed
-void static write_cband_header(encsp p, oBits& s) {
+template<typename S>
+void static write_cband_header(encsp p, S& s) {
     if (!is_banddiff(p)) // Is it needed
         return;
     push_sig("CB", s);
@@ -249,7 +245,8 @@ void static write_cband_header(encsp p, oBits& s) {
 }
 
 // Header for step, if used
-void static write_quanta_header(encsp p, oBits& s) {
+template<typename S>
+void static write_quanta_header(encsp p, S& s) {
     if (p->quanta < 2) // Is it needed
         return;
     push_sig("QV", s);
@@ -259,7 +256,8 @@ void static write_quanta_header(encsp p, oBits& s) {
 }
 
 // Write the encoding curve, if it's not the legacy Morton
-void static write_scanning_curve(encsp p, oBits& s) {
+template<typename S>
+void static write_scanning_curve(encsp p, S& s) {
     if (p->order == ZCURVE || p->mode == QB3M_STORED)
         return;
     push_sig("SC", s);
@@ -267,27 +265,66 @@ void static write_scanning_curve(encsp p, oBits& s) {
     s.push(p->order ? p->order : HILBERT, 64);
 }
 
+// Strip index, if strips are used
+// Block rows per strip, followed by the size of each strip in bytes
+template<typename S>
+void static write_strip_index(encsp p, S& s, const size_t* sizes) {
+    if (!p->strip || p->mode == QB3M_STORED)
+        return;
+    auto nstrips = strip_count(p->ysize, p->strip);
+    push_sig("SI", s);
+    s.push(2 + 4 * nstrips, 16);
+    s.push(p->strip, 16);
+    for (size_t i = 0; i < nstrips; i++)
+        s.push(sizes ? sizes[i] : 0u, 32);
+}
+
 // Data header has no known size
-void static write_data_header(encsp, oBits& s) {
+template<typename S>
+void static write_data_header(encsp, S& s) {
     push_sig("DT", s);
 }
 
 // Writes the headers, in the right order
 // Implicitly it defines the order of the headers,
 // which should end with the data header
-void static write_headers(encsp p, oBits& s) {
+// Strip sizes are not always known, the index has the same size regardless
+// Raw streams have no headers
+// The headers can go to a cBits, to get their size
+template<typename S>
+void static write_headers(encsp p, S& s, const size_t* sizes = nullptr) {
+    if (p->raw)
+        return;
     write_qb3_header(p, s);
     write_cband_header(p, s);
     write_quanta_header(p, s);
     write_scanning_curve(p, s);
+    write_strip_index(p, s, sizes);
     write_data_header(p, s);
 }
 
+// Size of the headers in bytes
+static size_t header_size(encsp p) {
+    cBits s;
+    write_headers(p, s);
+    return s.tobyte();
+}
+
 // Returns the number of bytes of value c
 static uint8_t run_count(const uint8_t* s, uint8_t c, uint8_t len = 0xff) {
-    for (uint8_t i = 0; i < len; i++, s++)
-        if (c != *s)
-            return i;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const auto vc = _mm_set1_epi8(static_cast<char>(c));
+    for (; i + 16 <= len; i += 16) {
+        uint64_t m = 0xffff ^ static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)), vc)));
+        if (m)
+            return static_cast<uint8_t>(i + topbit(m & (~m + 1)));
+    }
+#endif
+    for (; i < len; i++)
+        if (c != s[i])
+            return static_cast<uint8_t>(i);
     return len;
 }
 
@@ -298,285 +335,892 @@ static uint8_t run_count(const uint8_t* s, uint8_t c, uint8_t len = 0xff) {
 // FF FF N ->> 0 repeated N + 4 times, between 4 and 258 
 //
 
-static size_t RLE0FFFF(const uint8_t* src, size_t len, uint8_t* dst) {
-    uint8_t* d(dst);
-    while (len--) {
-        const uint8_t c = *src++; // non-special or last two bytes are alway copied
-        if (((c + 1) & 0xfe) || (2 > len)) {
-            *d++ = c;
-        }
-        else { // Special char, at least one more is available in src
-            uint8_t cc = *src; // not consumed here
-            if (c != cc) { // non-repeating special
-                *d++ = c; // Copy the first char, not special enough
-                continue;
-            }
-            // At least two special chars in a row
-            src++; // Consume the second byte, it will be handled
-            len--;
-
-            if (c) { // Two FFs in a row, encoded as FF FF FF
-                *d++ = c;
-                *d++ = c;
-                *d++ = c;
-                continue;
-            }
-            // Two zeros, if we don't have four it's not a run
-            if (2 > len || 0 != src[0] || 0 != src[1]) { // Not four zeros, emit two
-                *d++ = 0;
-                *d++ = 0;
-                continue;
-            }
+// Takes the input in pieces and writes the packed data as it goes
+// The output is the same as packing all the input at once. The last few bytes are held back,
+// until it is known whether they start a run. The output past the capacity is kept aside,
+// so it can still be expanded. Without an output, the packed size is counted
+class RLE0FFFF {
+public:
+    RLE0FFFF(uint8_t* out = nullptr, size_t capacity = 0)
+        : dst(out), cap(capacity), len(0), last(0), full(false) {}
 
-            // If the last emitted byte was FF this can't be encoded as a run
-            // emit one zero and put back the second
-            if (d != dst && 0xff == d[-1]) {
-                *d++ = 0;
-                len++;
-                src--;
-                continue;
+    void push(const uint8_t* src, size_t n) {
+        if (!tail.empty()) {
+            // Pack the held back bytes, with enough of the new ones to decide
+            auto held = tail.size();
+            auto more = n < LOOKAHEAD ? n : LOOKAHEAD;
+            tail.insert(tail.end(), src, src + more);
+            auto used = pack(tail.data(), tail.size(), held);
+            if (used < held) { // Not enough input yet, more was all of it
+                tail.erase(tail.begin(), tail.begin() + used);
+                return;
             }
+            tail.clear();
+            src += used - held;
+            n -= used - held;
+        }
+        auto used = pack(src, n, n);
+        tail.assign(src + used, src + n);
+    }
+
+    // Packs the held back bytes, returns the output size, 0 if it doesn't fit
+    size_t finish() {
+        for (size_t i = 0; i < tail.size();)
+            i += step(tail.data() + i, tail.size() - i);
+        tail.clear();
+        return full ? 0 : len;
+    }
+
+    // True if the output didn't fit
+    bool overflow() const { return full; }
+
+    // Output bytes so far
+    size_t size() const { return len; }
 
-            // at least four zeros on input, use the next two
-            src += 2;
-            len -= 2;
-            auto run = static_cast<uint8_t>(len < 0xff ? len : 0xfe); // Can't use 0xff
-            run = run_count(src, 0, run); // In addition to the four
-            // run, emit FF FF run (run is at least 4)
-            *d++ = 0xff;
-            *d++ = 0xff;
-            *d++ = run; // Signifying the 4 to 258 range
-            src += run;
-            len -= run;
+    // Input bytes held back
+    size_t held() const { return tail.size(); }
+
+    // Output past the capacity
+    const std::vector<uint8_t>& spilled() const { return spill; }
+
+private:
+    // Decisions never look further than this
+    static constexpr size_t LOOKAHEAD = 4 + 0xfe + 4;
+
+    // Packs the tokens which start before end and have LOOKAHEAD bytes after them
+    // Returns the number of bytes used
+    size_t pack(const uint8_t* src, size_t n, size_t end) {
+        end = std::min(end, n > LOOKAHEAD ? n - LOOKAHEAD : 0);
+        size_t i = 0;
+        while (i < end) {
+            // Copy the literals up to the next pair in bulk
+            auto span = rle_literals(src + i, end - i, true);
+            emit(src + i, span);
+            i += span;
+            if (i < end)
+                i += step(src + i, n - i);
         }
+        return i;
     }
-    return d - dst;
-}
 
-// Returns the size of the packed data, without writing anything
-static size_t RLE0FFFFSize(const uint8_t* src, size_t len) {
-    uint8_t last(0); // Last byte emitted, to avoid encoding runs of FFs
-    size_t count(0);
-    while (len--) {
-        const uint8_t c = *src++; // non-special or last two bytes are alway copied
-        if (((c + 1) & 0xfe) || (2 > len)) {
-            count++;
-            last = c;
+    void emit(uint8_t c) {
+        if (len >= cap) {
+            full = true;
+            if (dst)
+                spill.push_back(c);
         }
-        else { // Special char, at least one more is available in src
-            uint8_t cc = *src; // not consumed here
-            if (c != cc) { // non-repeating special
-                last = c;
-                count++;
-                continue;
-            }
-            // At least two special chars in a row
-            src++; // Consume the second byte, it will be handled
-            len--;
+        else if (dst)
+            dst[len] = c;
+        len++;
+        last = c;
+    }
 
-            if (c) { // Two FFs in a row, encoded as FF FF FF
-                last = 0xff;
-                count += 3;
-                continue;
-            }
-            // Two zeros, if we don't have four it's not a run
-            if (2 > len || 0 != src[0] || 0 != src[1]) { // Not four zeros, emit two
-                last = 0;
-                count += 2;
-                continue;
-            }
+    void emit(const uint8_t* src, size_t n) {
+        if (!n)
+            return;
+        auto m = std::min(n, cap - std::min(cap, len));
+        if (dst) {
+            if (m)
+                memcpy(dst + len, src, m);
+            spill.insert(spill.end(), src + m, src + n);
+        }
+        len += n;
+        full |= (m < n);
+        last = src[n - 1];
+    }
 
-            // If the last emitted byte was FF this can't be encoded as a run
-            // emit one zero and put back the second
-            if (0xff == last) {
-                last = 0;
-                count++;
-                len++;
-                src--;
-                continue;
-            }
+    // Packs one token from the n bytes at src, returns the number of bytes used
+    size_t step(const uint8_t* src, size_t n) {
+        const uint8_t c = src[0]; // non-special or last two bytes are alway copied
+        if (((c + 1) & 0xfe) || (n < 3) || (c != src[1])) {
+            emit(c);
+            return 1;
+        }
+        // At least two special chars in a row
+        if (c) { // Two FFs in a row, encoded as FF FF FF
+            emit(c);
+            emit(c);
+            emit(c);
+            return 2;
+        }
+        // Two zeros, if we don't have four it's not a run
+        if (n < 4 || 0 != src[2] || 0 != src[3]) { // Not four zeros, emit two
+            emit(0);
+            emit(0);
+            return 2;
+        }
+        // If the last emitted byte was FF this can't be encoded as a run
+        // emit one zero and put back the second
+        if (len && 0xff == last) {
+            emit(0);
+            return 1;
+        }
+        // at least four zeros on input, run, emit FF FF run (run is at least 4)
+        auto run = run_count(src + 4, 0, static_cast<uint8_t>(n - 4 < 0xff ? n - 4 : 0xfe));
+        emit(0xff);
+        emit(0xff);
+        emit(run); // Signifying the 4 to 258 range
+        return 4 + run;
+    }
 
-            // at least four zeros on input, use the next two
-            src += 2;
-            len -= 2;
-            uint8_t run = static_cast<uint8_t>(len < 0xff ? len : 0xfe); // Can't use 0xff
-            run = run_count(src, 0, run); // In addition to the four
-            // run, emit FF FF run (run is at least 4)
-            last = run;
-            count += 3;
-            src += run;
-            len -= run;
+    uint8_t* dst;
+    size_t cap, len;
+    uint8_t last; // Last byte emitted
+    bool full;
+    std::vector<uint8_t> tail;
+    std::vector<uint8_t> spill;
+};
+
+// Expands the RLE0FFFF data of one strip, returns the output size, or cap + 1 if it doesn't fit
+static size_t unRLE0FFFF(const uint8_t* src, size_t len, uint8_t* dst, size_t cap) {
+    size_t used = 0, n = 0;
+    while (used < len) {
+        // Copy the literals in bulk, a marker needs two more bytes
+        auto span = (len - used > 2) ? rle_literals(src + used, len - used - 2, false) : 0;
+        if (!span) { // One literal or one code
+            uint8_t c = src[used++];
+            size_t count = 1;
+            if (0xff == c && len - used >= 2 && 0xff == src[used]) {
+                count = (0xff == src[used + 1]) ? 2 : size_t(4) + src[used + 1];
+                c = (0xff == src[used + 1]) ? 0xff : 0;
+                used += 2;
+            }
+            if (count > cap - n)
+                return cap + 1;
+            memset(dst + n, c, count);
+            n += count;
+            continue;
         }
+        if (span > cap - n)
+            return cap + 1;
+        memcpy(dst + n, src + used, span);
+        used += span;
+        n += span;
     }
-    return count;
+    return n;
 }
 
 static size_t raw_size(encsp const &p) {
     return p->xsize * p->ysize * p->nbands * typesizes[p->type];
 }
 
+// Size of the stored mode output, it has fewer headers
+static size_t stored_size(encsp p) {
+    auto const mode = p->mode;
+    p->mode = QB3M_STORED;
+    auto size = header_size(p) + raw_size(p);
+    p->mode = mode;
+    return size;
+}
+
 int qb3_get_encoder_state(encsp p) { return p->error; }
 
+// The RLE modes are encoded the same as the matching base or CF mode
 static bool is_fast(qb3_mode mode) {
-    return (QB3M_BASE_H == mode) || (QB3M_BASE_Z == mode);
+    return (QB3M_BASE_H == mode) || (QB3M_BASE_Z == mode) || (QB3M_RLE_H == mode) || (QB3M_RLE == mode);
 }
 
-// ONLY QB3M_BASE and QB3M_CF are supported here
-template<typename T> static int enc(const T *source, oBits &s, encsp p)
-{
-    int error(0);
-    if (p->quanta < 2) {
-        if (is_fast(p->mode))
-            return QB3::encode_fast(source, s, *p);
-        else
-            return QB3::encode_best(source, s, *p);
+// Mode used to encode the data when the RLE pass is requested, QB3M_INVALID otherwise
+static qb3_mode rle_base(qb3_mode mode) {
+    switch (mode) {
+    case QB3M_RLE:
+        return QB3M_BASE_Z;
+    case QB3M_CF_RLE:
+        return QB3M_CF;
+    case QB3M_RLE_H:
+        return QB3M_BASE_H;
+    case QB3M_CF_RLE_H:
+        return QB3M_CF_H;
+    default:
+        return QB3M_INVALID;
     }
+}
 
-    // Quantized encoding
-    // Use a subencoder to encode one B lines strip at a time,
-    // while keeping the running state from one strip to the next
-    // This avoids doubling memory for the input data
-    encs subimg(*p);
-    subimg.ysize = B;
-    auto ysz(p->ysize);
-    // In bytes
-    auto linesize = p->xsize * p->nbands * typesizes[p->type];
-    // Temporary data buffer for a single strip
-    std::vector<uint8_t> buffer(linesize * subimg.ysize);
-    auto src = reinterpret_cast<const uint8_t*>(source);
-
-#define QENC(T)\
-    quantize(reinterpret_cast<T *>(buffer.data()), s, subimg);\
-    if (is_fast(subimg.mode))\
-        error = QB3::encode_fast(\
-            reinterpret_cast<std::make_unsigned<T>::type *>(buffer.data()), s, subimg);\
-    else\
-        error = QB3::encode_best(\
-            reinterpret_cast<std::make_unsigned<T>::type *>(buffer.data()), s, subimg);
-
-    for (size_t y = 0; y < ysz; y += subimg.ysize) {
-        // Shift the last strip up to handle the edge
-        if (y + subimg.ysize > ysz)
-            src -= linesize * (y + subimg.ysize - ysz);
-        memcpy(buffer.data(), src, buffer.size());
-        switch (p->type) {
-        case qb3_dtype::QB3_U8:  QENC(uint8_t);  break;
-        case qb3_dtype::QB3_I8:  QENC(int8_t);   break;
-        case qb3_dtype::QB3_U16: QENC(uint16_t); break;
-        case qb3_dtype::QB3_I16: QENC(int16_t);  break;
-        case qb3_dtype::QB3_U32: QENC(uint32_t); break;
-        case qb3_dtype::QB3_I32: QENC(int32_t);  break;
-        case qb3_dtype::QB3_U64: QENC(uint64_t); break;
-        case qb3_dtype::QB3_I64: QENC(int64_t);  break;
-        default: return QB3E_EINV;
+// Upper bound of the encoded size of a row of blocks, including the rung switches
+static size_t max_row_size(const encsp p) {
+    return max_data_size(p, B) + 2 * p->nbands * ((p->xsize + B - 1) / B) + STRIP_PAD;
+}
+
+// Takes the encoded data one row of blocks at a time and writes it to the output,
+// without going past the capacity. In RLE mode the bytes are packed as they are produced
+// If the packed output doesn't fit, or by calling unpack, packing stops. The packed bytes
+// are expanded in place and the encoding goes on without RLE, unless keep is set
+// Without an output, only the size is counted
+class enc_sink {
+public:
+    enc_sink(uint8_t* out = nullptr, size_t capacity = 0, size_t row_max = 0, bool rle = false,
+        bool keep = false)
+        : out(out), cap(capacity), rmax(row_max), rle(rle), keep(keep), pos(0), start(0), done(0),
+        packer(out, capacity) {}
+
+    // Encodes one row of blocks, returns an error code
+    int encode(const qb3_kernels* kernels, const void* src, encs& info, bool best) {
+        auto room = (pos / 8 < cap) ? cap - pos / 8 : 0;
+        if (!rle && room >= rmax)
+            return kernels->encode(src, out, pos, info, best);
+        // Encode in the row buffer, starting with the partial byte
+        row.resize(rmax + 1);
+        size_t rpos = pos % 8;
+        if (rpos && !rle && out)
+            row[0] = out[pos / 8];
+        auto error = kernels->encode(src, row.data(), rpos, info, best);
+        if (error)
+            return error;
+        if (rle) { // The partial byte is kept
+            packer.push(row.data(), rpos / 8);
+            row[0] = row[rpos / 8];
+        }
+        else {
+            if ((rpos + 7) / 8 > room)
+                return QB3E_NOSPACE;
+            if (out)
+                memcpy(out + pos / 8, row.data(), (rpos + 7) / 8);
+        }
+        pos += rpos - pos % 8;
+        // Goes on without packing if it didn't fit
+        if (rle && packer.overflow())
+            return keep ? QB3E_NOSPACE : unpack();
+        return 0;
+    }
+
+    // Ends the current strip, the next one starts byte aligned
+    // Returns the strip size in bytes, 0 if it doesn't fit
+    size_t strip() {
+        if (rle && pos % 8)
+            packer.push(row.data(), 1);
+        pos = (pos + 7) & ~size_t(7);
+        if (rle) {
+            packer.finish();
+            if (packer.overflow() && (keep || unpack()))
+                return 0;
+        }
+        auto size = rle ? packer.size() : pos / 8 - start;
+        raws.push_back(pos / 8 - start);
+        list.push_back(size);
+        done += size;
+        start = pos / 8;
+        if (rle)
+            packer = RLE0FFFF(out ? out + done : nullptr, cap - std::min(cap, done));
+        return size;
+    }
+
+    // Stops packing, the strips done so far are expanded. Returns an error code
+    int unpack() {
+        if (!rle)
+            return 0;
+        packer.finish();
+        if ((pos + 7) / 8 > cap)
+            return QB3E_NOSPACE;
+        rle = false;
+        if (out) {
+            // Including the current strip
+            std::vector<uint8_t> packed(out, out + std::min(cap, done + packer.size()));
+            packed.insert(packed.end(), packer.spilled().begin(), packer.spilled().end());
+            auto psizes(list), usizes(raws);
+            psizes.push_back(packer.size());
+            usizes.push_back(pos / 8 - start);
+            size_t from = 0, to = 0;
+            for (size_t i = 0; i < psizes.size(); i++) {
+                if (usizes[i] != unRLE0FFFF(packed.data() + from, psizes[i], out + to, usizes[i]))
+                    return QB3E_EINV;
+                from += psizes[i];
+                to += usizes[i];
+            }
+            if (pos % 8)
+                out[pos / 8] = row[0];
+        }
+        list = raws;
+        done = start;
+        packer = RLE0FFFF();
+        return 0;
+    }
+
+    // True while the output is packed
+    bool packing() const { return rle; }
+
+    // Output size of the finished strips, in bytes
+    size_t size() const { return done; }
+
+    // Size of the finished strips before RLE, in bytes
+    size_t raw_size() const { return start; }
+
+    // Output size of each finished strip
+    const std::vector<size_t>& sizes() const { return list; }
+
+    // Bits encoded so far, before RLE
+    size_t bits() const { return pos; }
+
+private:
+    uint8_t* out;
+    size_t cap, rmax;
+    bool rle, keep;
+    size_t pos;   // Bit position, before RLE
+    size_t start; // Start of the current strip, before RLE
+    size_t done;  // Output size of the finished strips
+    RLE0FFFF packer;
+    std::vector<size_t> list; // Output size of each finished strip
+    std::vector<size_t> raws; // Size of each finished strip, before RLE
+    std::vector<uint8_t> row; // Output of one row of blocks
+};
+
+// Most block rows between two checks of the adaptive encoding
+constexpr size_t PICK_GAP(32);
+
+// Picks the fast or the best method for each row of blocks, in adaptive mode
+// Some rows also get sized with the other method, on a copy of the state, then the smaller
+// one is used for the next rows. Best has to save more than 1/64 of the size to be picked
+// The rows between checks grow while the choice holds, and go to the most if best doesn't
+// help at all, which is common
+class row_picker {
+public:
+    row_picker(bool best = false, bool adaptive = false)
+        : best(best), adaptive(adaptive && best), wait(0), gap(1) {}
+
+    // Encodes one row of blocks through the sink, returns an error code
+    int encode(enc_sink& sink, const void* src, encs& info) {
+        if (!adaptive)
+            return sink.encode(info.kernels, src, info, best);
+        if (wait) {
+            wait--;
+            return sink.encode(info.kernels, src, info, best);
         }
-        src += linesize * subimg.ysize;
+        encs other(info);
+        size_t alt = 0;
+        auto start = sink.bits();
+        auto error = info.kernels->encode(src, nullptr, alt, other, !best);
+        if (!error)
+            error = sink.encode(info.kernels, src, info, best);
+        if (error)
+            return error;
+        auto size = sink.bits() - start;
+        auto fast = best ? alt : size;
+        auto slow = best ? size : alt;
+        bool choice = slow + fast / 64 < fast;
+        gap = (slow >= fast) ? PICK_GAP : (choice == best) ? std::min(4 * gap, PICK_GAP) : 1;
+        best = choice;
+        wait = gap;
+        return 0;
     }
 
-#undef QENC
-    return error;
+private:
+    bool best, adaptive;
+    size_t wait; // Rows left until the next check
+    size_t gap;
+};
+
+// Encodes the image through the sink one row of blocks at a time
+// The sink strip is not ended. Returns an error code
+static int enc_rows(const void* source, const encs& info, enc_sink& sink) {
+    encs sub(info);
+    sub.ysize = B;
+    row_picker picker(!is_fast(info.mode), info.adaptive);
+    auto linesize = info.xsize * info.nbands * typesizes[info.type];
+    auto src = static_cast<const uint8_t*>(source);
+    for (size_t y = 0; y < info.ysize; y += B) {
+        // Shift the last row up to handle the edge
+        auto error = picker.encode(sink, src + linesize * std::min(y, info.ysize - B), sub);
+        if (error)
+            return error;
+    }
+    return 0;
 }
 
-// The encode public API, returns 0 if an error is detected
-size_t qb3_encode(encsp p, void* source, void* destination) {
-    auto const mode = p->mode; // save the user chosen mode
-    // Turn off the RLE for now
-    bool rle = (QB3M_RLE == mode || QB3M_CF_RLE == mode || QB3M_CF_RLE_H == mode || QB3M_RLE_H == mode);
+// Encode at bit position pos of d, which gets updated
+// The kernels quantize the values as they are read, there is no need for a copy
+static int enc_typed(const void* source, uint8_t* d, size_t& pos, encsp p)
+{
+    // The running state is per call, p only holds the settings
+    encs sub(*p);
+    for (size_t c = 0; c < sub.nbands; c++)
+        sub.band[c].prev = sub.band[c].runbits = sub.band[c].cf = 0;
+    return p->kernels->encode(source, d, pos, sub, !is_fast(p->mode));
+}
+
+// Encode the image as independent strips, each one in a reserved region of the output
+// then move them together. Returns the data size, the strip sizes are placed in sizes
+// With RLE, each strip is packed by itself. If packing doesn't reduce the total size, all the
+// strips are expanded and rle is cleared
+// In adaptive mode, the strips that don't get smaller are stored, flagged in sizes
+// Without an output, only the sizes are computed
+static size_t enc_strips(const void* source, uint8_t* d, encsp p, std::vector<size_t>& sizes,
+    bool& rle)
+{
+    auto nstrips = strip_count(p->ysize, p->strip);
+    auto linesize = p->xsize * p->nbands * typesizes[p->type];
+    // Start of the reserved output region for each strip
+    std::vector<size_t> region(nstrips + 1);
+    for (size_t i = 0; i < nstrips; i++) {
+        auto lines = strip_lines(p->ysize, p->strip, i);
+        region[i + 1] = region[i] + max_data_size(p, lines.second - lines.first) + STRIP_PAD;
+    }
+    std::vector<int> errors(nstrips);
+    std::vector<char> stored(nstrips);
+    std::vector<enc_sink> sinks(nstrips);
+    const bool sink = rle || p->adaptive;
+    sizes.assign(nstrips, 0);
+    parallel_for(nstrips, p->threads, [&](size_t i) {
+        auto lines = strip_lines(p->ysize, p->strip, i);
+        encs sub(*p);
+        sub.ysize = lines.second - lines.first;
+        for (size_t c = 0; c < sub.nbands; c++)
+            sub.band[c].prev = sub.band[c].runbits = sub.band[c].cf = 0;
+        auto src = static_cast<const uint8_t*>(source) + lines.first * linesize;
+        if (sink) {
+            sinks[i] = enc_sink(d ? d + region[i] : nullptr, region[i + 1] - region[i], max_row_size(p), rle);
+            errors[i] = enc_rows(src, sub, sinks[i]);
+            if (!errors[i] && !sinks[i].strip())
+                errors[i] = QB3E_NOSPACE;
+        }
+        else {
+            size_t pos = 0;
+            errors[i] = enc_typed(src, d ? d + region[i] : nullptr, pos, &sub);
+            sizes[i] = (pos + 7) / 8;
+        }
+    });
+    // Packing is kept only if it helps all the strips together
     if (rle) {
-        switch (mode) {
-        case QB3M_RLE:
-            p->mode = QB3M_BASE_Z;
-            break;
-        case QB3M_CF_RLE:
-            p->mode = QB3M_CF;
-            break;
-        case QB3M_RLE_H:
-            p->mode = QB3M_BASE_H;
-            break;
-        case QB3M_CF_RLE_H:
-            p->mode = QB3M_CF_H;
-            break;
-        default: // Library internal error
-            p->error = 255;
-            return 0;
+        size_t len = 0, raw = 0;
+        for (size_t i = 0; i < nstrips; i++) {
+            if (errors[i])
+                continue;
+            rle &= sinks[i].packing();
+            len += sinks[i].size();
+            raw += sinks[i].raw_size();
         }
-        //p->mode = (QB3M_RLE == mode) ? QB3M_BASE : QB3M_CF;
+        if (len >= raw)
+            rle = false;
+        if (!rle)
+            parallel_for(nstrips, p->threads, [&](size_t i) {
+                if (!errors[i])
+                    errors[i] = sinks[i].unpack();
+            });
     }
+    if (sink)
+        for (size_t i = 0; i < nstrips; i++)
+            if (!errors[i])
+                sizes[i] = sinks[i].size();
+    // Store the strips that don't get smaller, the region is large enough
+    if (p->adaptive)
+        for (size_t i = 0; i < nstrips; i++) {
+            auto lines = strip_lines(p->ysize, p->strip, i);
+            auto src = static_cast<const uint8_t*>(source) + lines.first * linesize;
+            auto rawsize = (lines.second - lines.first) * linesize;
+            if (QB3E_NOSPACE == errors[i] || (!errors[i] && sizes[i] >= rawsize)) {
+                if (d)
+                    memcpy(d + region[i], src, rawsize);
+                sizes[i] = rawsize;
+                errors[i] = 0;
+                stored[i] = 1;
+            }
+        }
+    // Pack the strips, in order. The size has to fit in 31 bits
+    size_t len = 0;
+    for (size_t i = 0; i < nstrips; i++) {
+        p->error = errors[i] ? errors[i] : (sizes[i] >> 31) ? QB3E_EINV : 0;
+        if (p->error)
+            return 0;
+        if (d)
+            memmove(d + len, d + region[i], sizes[i]);
+        len += sizes[i];
+        if (stored[i])
+            sizes[i] |= QB3_STORED_STRIP;
+    }
+    return len;
+}
+
+// Write the source in stored mode, returns the size or 0 if it doesn't fit in capacity
+// Without an output, only returns the size
+static size_t enc_stored(encsp p, const void* source, uint8_t* d, size_t capacity) {
+    auto const mode = p->mode;
+    p->mode = QB3M_STORED; // Force raw mode
+    auto hsize = header_size(p);
+    if (hsize + raw_size(p) > capacity)
+        p->error = QB3E_NOSPACE;
+    else if (d) {
+        oBits s(d);
+        write_headers(p, s);
+        memcpy(d + hsize, source, raw_size(p));
+    }
+    p->mode = mode; // restore the user selected mode, in case of reuse
+    return p->error ? 0 : hsize + raw_size(p);
+}
+
+// Encodes the source to d, returns 0 if an error is detected
+// Without an output, it only returns the size
+static size_t encode_to(encsp p, const void* source, uint8_t* d) {
+    p->error = 0; // A previous call might have failed
+    auto const mode = p->mode; // save the user chosen mode
+    // The RLE is applied as the data is encoded
+    bool rle = (QB3M_INVALID != rle_base(mode));
 
-    uint8_t* const d = reinterpret_cast<uint8_t*>(destination);
-    oBits s(d);
     // size of headers or zero if raw
-    size_t data_position(0);
-    write_headers(p, s);
-    data_position = (s.position() + 7) / 8; // It is byte aligned already
+    size_t data_position = header_size(p);
+    if (d) {
+        oBits s(d);
+        write_headers(p, s);
+    }
     if (p->error) return 0;
 
-#define ENC(T) enc(reinterpret_cast<const T*>(source), s, p)
-    switch (p->type) {
-    case qb3_dtype::QB3_U8:
-    case qb3_dtype::QB3_I8:
-        p->error = ENC(uint8_t); break;
-    case qb3_dtype::QB3_U16:
-    case qb3_dtype::QB3_I16:
-        p->error = ENC(uint16_t); break;
-    case qb3_dtype::QB3_U32:
-    case qb3_dtype::QB3_I32:
-        p->error = ENC(uint32_t); break;
-    case qb3_dtype::QB3_U64:
-    case qb3_dtype::QB3_I64:
-        p->error = ENC(uint64_t); break;
-    default:
-        p->error = QB3E_EINV; // Invalid type
-    } // data type
-#undef ENC
+    // Size of each strip, a single one if strips are not used
+    std::vector<size_t> sizes(1);
+    size_t len(0); // current output position in bytes
+    if (p->strip) {
+        len = data_position + enc_strips(source, d ? d + data_position : nullptr, p, sizes, rle);
+    }
+    else if (rle || p->adaptive) {
+        // Data larger than the raw size is always stored
+        // The mode of a raw stream is not stored, it has to stay packed
+        enc_sink sink(d ? d + data_position : nullptr, raw_size(p), max_row_size(p), rle, p->raw);
+        p->error = enc_rows(source, *p, sink);
+        if (!p->error && !sink.strip())
+            p->error = QB3E_NOSPACE;
+        if (!p->error && rle && !p->raw && sink.size() >= sink.raw_size())
+            p->error = sink.unpack();
+        rle = sink.packing();
+        len = data_position + sink.size();
+    }
+    else {
+        size_t pos = data_position * 8;
+        p->error = enc_typed(source, d, pos, p);
+        len = (pos + 7) / 8;
+    }
+    if (p->error && QB3E_NOSPACE != p->error)
+        return 0;
 
-    auto len = (s.position() + 7) / 8; // current output position in bytes
-    if (rle) {
-        p->mode = mode; // restore the user selected mode that includes RLE
-        if (p->error) // Bail out if there was an error
-            return 0;
+    // Record the strip sizes and the mode, if packing was dropped
+    if (!p->error && d && (p->strip || rle != (QB3M_INVALID != rle_base(mode)))) {
+        if (!rle && QB3M_INVALID != rle_base(mode))
+            p->mode = rle_base(mode);
+        oBits shdr(d);
+        write_headers(p, shdr, sizes.data());
+        p->mode = mode;
+    }
+
+    // Maybe stored mode is better
+    if (p->error || (rle ? stored_size(p) : raw_size(p)) <= len) {
+        p->error = 0;
+        return enc_stored(p, source, d, qb3_max_encoded_size(p));
+    }
+    return len;
+}
+
+// The encode public API, returns 0 if an error is detected
+size_t qb3_encode(encsp p, void* source, void* destination) {
+    if (p->stream) { // Incremental encoding in progress
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    return encode_to(p, source, static_cast<uint8_t*>(destination));
+}
+
+size_t qb3_encoded_size(encsp p, const void* source) {
+    if (p->stream) { // Incremental encoding in progress
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    return encode_to(p, source, nullptr);
+}
+
+qb3_configp qb3_create_config(const encsp p) {
+    if (p->stream) // Incremental encoding in progress
+        return nullptr;
+    auto config = new encs(*p);
+    config->error = 0;
+    return config;
+}
+
+// Encodes with a local copy of the settings, so they can be shared
+size_t qb3_encode_with(qb3_configp config, const void* source, void* destination) {
+    encs e(*config);
+    return qb3_encode(&e, const_cast<void*>(source), destination);
+}
 
-        // Skip RLE if the compression is poor, this is a vague limit
-        if (len <= qb3_max_encoded_size(p) / 2) {
-            auto data_size = len - data_position; // Exclude the headers, they will be rewritten
-            auto available = qb3_max_encoded_size(p) - len;
-            // Get the size of the RLE0FFFF
-            auto rle_size = RLE0FFFFSize(d + data_position, data_size);
-            if (rle_size <= available && rle_size < data_size) { // Only if it fits and is small enough
-                // Encode it at the end of the data
-                auto new_size = RLE0FFFF(d + data_position, data_size, d + len);
-                // Check that it worked
-                if (new_size != rle_size) { // Paranoid check
-                    p->error = QB3E_EINV; // Something went wrong, bail out
-                    return 0;
-                }
-
-                // new stream, same buffer
-                oBits srle(d);
-                write_headers(p, srle);
-                if (p->error)
-                    return 0;
-                // Copy the RLE encoded data at the current position, they are not overlapping
-                memcpy(d + srle.tobyte(), d + len, rle_size);
-                // Return the new size
-                return srle.tobyte() + rle_size;
+void qb3_destroy_config(qb3_configp config) {
+    delete config;
+}
+
+size_t qb3_encode_batch(qb3_configp config, size_t n, void** sources, void** destinations,
+    size_t* sizes)
+{
+    if (!config || config->stream || (n && (!sources || !destinations || !sizes)))
+        return 0;
+    // Every image is encoded with a copy of these settings
+    encs base(*config);
+    base.error = 0;
+    base.threads = 1; // Images are already encoded in parallel
+    const size_t maxsize = qb3_max_encoded_size(&base);
+    auto threads = std::min(qb3_threads(config->threads), n);
+    // Each worker takes the next image, with its own scratch output
+    std::atomic<size_t> next(0), done(0);
+    parallel_for(threads, threads, [&](size_t) {
+        std::vector<uint8_t> scratch; // For destinations which might be too small
+        for (size_t i = next++; i < n; i = next++) {
+            encs sub(base);
+            auto cap = sizes[i];
+            auto d = static_cast<uint8_t*>(destinations[i]);
+            if (cap && cap < maxsize) {
+                scratch.resize(maxsize);
+                d = scratch.data();
+            }
+            auto len = qb3_encode(&sub, sources[i], d);
+            if (len && d != destinations[i]) {
+                if (len <= cap)
+                    memcpy(destinations[i], d, len);
+                else
+                    sub.error = QB3E_NOSPACE;
             }
+            sizes[i] = sub.error ? 0 : len;
+            if (!sub.error)
+                done++;
         }
+    });
+    return done;
+}
+
+// Incremental encoding state
+struct enc_stream {
+    uint8_t* out;    // Output buffer
+    size_t line;     // Lines received
+    size_t filled;   // Lines in the buffer
+    size_t row;      // Block rows encoded
+    size_t data;     // Start of the data, in bytes
+    encs sub;        // Encodes one block row, holds the running state
+    enc_sink sink;   // Output, after the headers
+    row_picker picker; // Fast or best, per block row
+    std::vector<uint8_t> buffer; // B lines
+};
+
+static void drop_stream(encsp p) {
+    delete p->stream;
+    p->stream = nullptr;
+}
+
+// Starts the incremental encoding into a buffer of capacity bytes
+// The data, after the headers, is limited to data_limit bytes
+static bool stream_begin(encsp p, void* destination, size_t capacity, size_t data_limit = ~size_t(0)) {
+    drop_stream(p);
+    p->error = destination ? 0 : QB3E_EINV;
+    if (p->error)
+        return false;
+    auto data = header_size(p);
+    if (!p->error && data > capacity)
+        p->error = QB3E_NOSPACE;
+    if (p->error)
+        return false;
+    auto st = new enc_stream;
+    p->stream = st;
+    st->out = reinterpret_cast<uint8_t*>(destination);
+    oBits s(st->out);
+    write_headers(p, s);
+    st->data = data;
+    st->line = st->filled = st->row = 0;
+    st->sink = enc_sink(st->out + data, std::min(capacity - data, data_limit), max_row_size(p),
+        QB3M_INVALID != rle_base(p->mode), p->raw);
+    st->picker = row_picker(!is_fast(p->mode), p->adaptive);
+    // The block row encoder starts with a fresh state
+    st->sub = *p;
+    st->sub.ysize = B;
+    for (size_t c = 0; c < p->nbands; c++)
+        st->sub.band[c].prev = st->sub.band[c].runbits = st->sub.band[c].cf = 0;
+    st->buffer.resize(p->xsize * p->nbands * typesizes[p->type] * B);
+    return true;
+}
+
+bool qb3_encode_begin(encsp p, void* destination) {
+    return stream_begin(p, destination, qb3_max_encoded_size(p));
+}
+
+// Encode one block row from src
+static int stream_row(encsp p, const void* src) {
+    auto& st = *p->stream;
+    // Strips start byte aligned, with a fresh state
+    if (p->strip && st.row && 0 == st.row % p->strip) {
+        if (!st.sink.strip())
+            return QB3E_NOSPACE;
+        for (size_t c = 0; c < p->nbands; c++)
+            st.sub.band[c].prev = st.sub.band[c].runbits = st.sub.band[c].cf = 0;
+        st.picker = row_picker(!is_fast(p->mode), p->adaptive);
     }
+    st.row++;
+    return st.picker.encode(st.sink, src, st.sub);
+}
 
-    // Maybe stored mode is better
-    if (!p->error && raw_size(p) <= len) {
-        // new stream, same buffer
-        oBits sraw(d);
-        p->mode = QB3M_STORED; // Force raw mode
-        write_headers(p, sraw);
+bool qb3_encode_rows(encsp p, const void* rows, size_t nrows) {
+    if (!p->stream || p->error || nrows > p->ysize - p->stream->line) {
+        if (!p->error)
+            p->error = QB3E_EINV;
+        return false;
+    }
+    auto& st = *p->stream;
+    auto linesize = p->xsize * p->nbands * typesizes[p->type];
+    auto src = reinterpret_cast<const uint8_t*>(rows);
+    // The last full block row is also needed for the edge, if the last one is partial
+    const size_t last = p->ysize - p->ysize % B;
+    while (nrows && !p->error) {
+        // Whole block rows are encoded in place
+        if (0 == st.filled && nrows >= B) {
+            p->error = stream_row(p, src);
+            st.line += B;
+            if (st.line == last && last != p->ysize)
+                memcpy(st.buffer.data(), src, st.buffer.size());
+            src += B * linesize;
+            nrows -= B;
+            continue;
+        }
+        auto n = std::min(nrows, B - st.filled);
+        memcpy(st.buffer.data() + st.filled * linesize, src, n * linesize);
+        st.filled += n;
+        st.line += n;
+        src += n * linesize;
+        nrows -= n;
+        if (B == st.filled) {
+            p->error = stream_row(p, st.buffer.data());
+            st.filled = 0;
+        }
+        else if (st.line == p->ysize) {
+            // The last block row is shifted up, so it overlaps the previous one
+            // which is still in the buffer, after the new lines
+            std::rotate(st.buffer.begin(), st.buffer.begin() + st.filled * linesize, st.buffer.end());
+            p->error = stream_row(p, st.buffer.data());
+            st.filled = 0;
+        }
+    }
+    return !p->error;
+}
+
+// Finish the incremental encoding, returns the size or 0 on failure
+// If packed is not null, it is set when the output is packed
+static size_t stream_end(encsp p, bool* packed = nullptr) {
+    if (!p->stream) {
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    auto& st = *p->stream;
+    auto const mode = p->mode;
+    if (!p->error && st.line != p->ysize)
+        p->error = QB3E_EINV; // Not all the lines were received
+    if (!p->error && !st.sink.strip())
+        p->error = QB3E_NOSPACE;
+    // As in qb3_encode, the output is packed only if it gets smaller
+    auto& sink = st.sink;
+    if (!p->error && sink.packing() && !p->raw && sink.size() >= sink.raw_size())
+        p->error = sink.unpack();
+    if (packed)
+        *packed = sink.packing();
+    for (auto size : sink.sizes())
+        if (size >> 31) // Has to fit in 31 bits
+            p->error = QB3E_EINV;
+    // Record the strip sizes and the mode, if packing was dropped
+    bool dropped = !sink.packing() && QB3M_INVALID != rle_base(mode);
+    if (!p->error && (p->strip || dropped)) {
+        if (dropped)
+            p->mode = rle_base(mode);
+        oBits shdr(st.out);
+        write_headers(p, shdr, sink.sizes().data());
+        p->mode = mode;
+    }
+    auto len = st.data + sink.size();
+    drop_stream(p);
+    return (p->error) ? 0 : len;
+}
+
+size_t qb3_encode_end(encsp p) {
+    auto len = stream_end(p);
+    // A raw stream of this size would be read as stored, qb3_encode_bounded avoids it
+    if (p->raw && len == raw_size(p)) {
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    return len;
+}
+
+size_t qb3_encode_bounded(encsp p, void* source, void* destination, size_t capacity) {
+    if (p->stream) { // Incremental encoding in progress
+        p->error = QB3E_EINV;
+        return 0;
+    }
+    // The incremental encoder can't store strips, encode them in full and copy if they fit
+    if (p->adaptive && p->strip) {
+        std::vector<uint8_t> scratch(qb3_max_encoded_size(p));
+        auto len = encode_to(p, source, scratch.data());
         if (p->error)
             return 0;
-        // Copy the raw data at the current position, they are not overlapping
-        memcpy(d + sraw.tobyte(), source, raw_size(p));
-        p->mode = mode; // restore the user selected mode, in case of reuse
-        // Return the new size
-        return sraw.tobyte() + raw_size(p);
+        if (len <= capacity) {
+            memcpy(destination, scratch.data(), len);
+            return len;
+        }
+        return enc_stored(p, source, static_cast<uint8_t*>(destination), capacity);
+    }
+    // Data larger than the raw size is always stored, stop there
+    size_t len = 0;
+    bool packed = false;
+    if (stream_begin(p, destination, capacity, raw_size(p))) {
+        if (qb3_encode_rows(p, source, p->ysize))
+            len = stream_end(p, &packed);
+        else
+            drop_stream(p);
+    }
+    if (p->error && QB3E_NOSPACE != p->error)
+        return 0;
+    // Same choice as qb3_encode
+    if (p->error || (packed ? stored_size(p) : raw_size(p)) <= len) {
+        p->error = 0;
+        return enc_stored(p, source, static_cast<uint8_t*>(destination), capacity);
     }
-    return (p->error) ? 0 : s.tobyte();
+    return len;
+}
+
+qb3_mode qb3_estimate(encsp p, void* source, double fraction, double gain, size_t* sizes) {
+    if (p->stream || !(fraction > 0)) {
+        p->error = QB3E_EINV;
+        return QB3M_INVALID;
+    }
+    p->error = 0;
+    // Evenly spread rows of blocks
+    size_t nrows = (p->ysize + B - 1) / B;
+    size_t count = std::max(size_t(1), std::min(nrows, static_cast<size_t>(nrows * fraction + 0.5)));
+    auto linesize = p->xsize * p->nbands * typesizes[p->type];
+    // Fast and best, the band state runs from one sample to the next
+    // Only the sizes are counted, the samples are packed as if they were contiguous
+    encs sub[2] = { *p, *p };
+    enc_sink sink[2];
+    for (int m = 0; m < 2; m++) {
+        sub[m].ysize = B;
+        for (size_t c = 0; c < p->nbands; c++)
+            sub[m].band[c].prev = sub[m].band[c].runbits = sub[m].band[c].cf = 0;
+        sink[m] = enc_sink(nullptr, ~size_t(0), max_row_size(p), true, true);
+    }
+    for (size_t i = 0; i < count && !p->error; i++) {
+        auto y = std::min((i * nrows / count) * B, p->ysize - B);
+        auto src = static_cast<const uint8_t*>(source) + y * linesize;
+        for (int m = 0; m < 2 && !p->error; m++)
+            p->error = sink[m].encode(p->kernels, src, sub[m], m == 1);
+    }
+    if (p->error)
+        return QB3M_INVALID;
+
+    // Scale to the whole image, the headers are about the same for all modes
+    size_t hsize = header_size(p);
+    size_t est[5];
+    for (int m = 0; m < 2; m++) {
+        sink[m].strip();
+        est[m] = hsize + static_cast<size_t>(double(sink[m].raw_size()) * nrows / count);
+        est[m + 2] = std::min(est[m], hsize + static_cast<size_t>(double(sink[m].size()) * nrows / count));
+    }
+    est[4] = stored_size(p);
+    if (sizes)
+        for (int m = 0; m < 5; m++)
+            sizes[m] = est[m];
+
+    // From the fastest to the slowest, a slower one has to be smaller by gain
+    bool z = (p->order == ZCURVE);
+    const qb3_mode modes[4] = { z ? QB3M_BASE_Z : QB3M_BASE_H, z ? QB3M_RLE : QB3M_RLE_H,
+        z ? QB3M_CF : QB3M_CF_H, z ? QB3M_CF_RLE : QB3M_CF_RLE_H };
+    const size_t order[4] = { 0, 2, 1, 3 };
+    size_t choice = 0;
+    for (size_t i = 1; i < 4; i++)
+        if (est[order[i]] < est[order[choice]] * (1 - gain))
+            choice = i;
+    // If stored is not larger, the output gets stored anyway, use the fastest
+    return modes[(est[4] <= est[order[choice]]) ? 0 : choice];
 }
@@ -17,7 +17,6 @@ Contributors:  Lucian Plesea
 
 #pragma once
 #include "QB3common.h"
-#include <algorithm>
 
 namespace QB3 {
 // Encoding tables for rungs up to 8, for speedup. Rung 0 and 1 are special
@@ -82,9 +81,6 @@ static const uint16_t csw6[] = { 0x1000, 0x6001, 0x6009, 0x6011, 0x6019, 0x6021,
 0x601d, 0x6015, 0x600d, 0x6005 };
 static const uint16_t* CSW[] = { nullptr, nullptr, nullptr, csw3, csw4, csw5, csw6 };
 
-// Absolute from mag-sign
-template<typename T> static T magsabs(T v) { return (v >> 1) + (v & 1); }
-
 // integer divide count(in magsign) by cf(normal, positive)
 template<typename T> static T magsdiv(T val, T cf) {return ((magsabs(val) / cf) << 1) - (val & 1);}
 
@@ -123,39 +119,119 @@ template<typename T> static T gcf(const T* group){
 // No conditionals, computes all three values and picks one by masking with the condition
 // It is faster than similar code with conditions because the calculations for the three lines get interleaved
 // The "(~0ull * (1 & <cond>))" is to show the compiler that it is a mask operation
-static std::pair<size_t, uint64_t> qb3csz(uint64_t val, size_t rung) {
+static codeword qb3csz(uint64_t val, size_t rung) {
     assert(rung > 1); // Works for rungs 2+
     uint64_t nxt = (val >> (rung - 1)) & 1;
     uint64_t top = val >> rung;
     uint64_t tb = 1ull << rung;
-    return std::make_pair<size_t, uint64_t>(rung + top + (top | nxt),
+    return { static_cast<size_t>(rung + top + (top | nxt)),
           ((~0ull * (1 & ~(top | nxt))) & (val << 1))                     // 0 0 SHORT    -> _x0
         + ((~0ull * (1 & (~top & nxt))) & ((((val << 1) ^ tb) << 1) | 1)) // 0 1 NOMINAL  -> _01
-        + ((~0ull * (1 & top))          & (((val ^ tb) << 2) | 0b11)));   // 1 x LONG     -> _11
+        + ((~0ull * (1 & top))          & (((val ^ tb) << 2) | 0b11)) };  // 1 x LONG     -> _11
 }
 
 // Single value QB3 encode, possibly using tables, works for all rungs
-static std::pair<size_t, uint64_t> qb3csztbl(uint64_t val, size_t rung) {
+static codeword qb3csztbl(uint64_t val, size_t rung) {
     if ((sizeof(CRG) / sizeof(*CRG)) > rung) {
         auto cs = CRG[rung][val];
-        return std::make_pair<size_t, uint64_t>(cs >> 12, cs & TBLMASK);
+        return { static_cast<size_t>(cs >> 12), cs & TBLMASK };
     }
     return qb3csz(val, rung);
 }
 
+// Encode a group at rung > 1 after acc, which holds abits <= 8. The codes and lengths are computed
+// together, without branches, then merged at their offsets in a local buffer which is pushed 64
+// bits at a time. Codes can be at most 64 bits, so it doesn't work at rung 63
+template <typename T, typename S>
+static void hencode(const T group[B2], size_t rung, S& s, uint64_t acc, size_t abits) {
+    // The code is the value shifted left by 1 when short. Otherwise the top bit is flipped and
+    // the value is shifted by 2, with the low bits set to 01 for nominal, 11 for long
+    uint64_t code[B2], len[B2];
+#if defined(__AVX2__)
+    const auto one = _mm256_set1_epi64x(1);
+    const auto r = _mm256_set1_epi64x(rung);
+    const auto r1 = _mm256_set1_epi64x(rung - 1);
+    for (size_t i = 0; i < B2; i += 4) {
+        __m256i v;
+        if (sizeof(T) == 2)
+            v = _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(group + i)));
+        else if (sizeof(T) == 4)
+            v = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group + i)));
+        else
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group + i));
+        auto top = _mm256_srlv_epi64(v, r);
+        auto t = _mm256_or_si256(top, _mm256_and_si256(_mm256_srlv_epi64(v, r1), one));
+        auto x = _mm256_xor_si256(v, _mm256_sllv_epi64(t, _mm256_add_epi64(r1, top)));
+        auto c = _mm256_or_si256(_mm256_sllv_epi64(x, _mm256_add_epi64(one, t)),
+            _mm256_or_si256(t, _mm256_add_epi64(top, top)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(code + i), c);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(len + i), _mm256_add_epi64(r, _mm256_add_epi64(top, t)));
+    }
+#else
+    for (size_t i = 0; i < B2; i++) {
+        uint64_t v = group[i];
+        uint64_t top = v >> rung;
+        uint64_t t = top | ((v >> (rung - 1)) & 1);
+        code[i] = ((v ^ (t << (rung - 1 + top))) << (1 + t)) | t | (top << 1);
+        len[i] = rung + top + t;
+    }
+#endif
+    // Merge the codes, each one spans at most two words. Up to rung 30 two codes fit
+    // in 64 bits, up to rung 14 four of them do, so they get merged before
+    uint64_t buf[B2 + 2] = { acc };
+    const size_t stride = rung < 15 ? 4 : rung < 31 ? 2 : 1;
+    for (size_t i = 0; i < B2; i += stride) {
+        auto c = code[i], l = len[i];
+        for (size_t j = 1; j < stride; j++) {
+            c |= code[i + j] << l;
+            l += len[i + j];
+        }
+        auto w = abits / 64, sh = abits % 64;
+        buf[w] |= c << sh;
+        buf[w + 1] |= (c >> 1) >> (63 - sh);
+        abits += l;
+    }
+    for (size_t i = 0; abits; i++) {
+        auto n = abits < 64 ? abits : 64;
+        s.push(buf[i], n);
+        abits -= n;
+    }
+}
+
 // only encode the group entries, not the rung switch
 // maxval is used to choose the rung for encoding
 // If abits > 0, the accumulator is also pushed into the stream
+#if defined(__BMI2__)
+// Rung 1 codewords for a group, as length and bits
+// Each value gets a 3 bit slot, with the codeword bits in order and a mask of the used bits
+// 0 -> 0, 1 -> 10, 2 -> 110, 3 -> 111, the PEXT packs the used bits together
 template <typename T>
-static void groupencode(T group[B2], T maxval, oBits& s, uint64_t acc, size_t abits)
+static codeword rung1(const T group[B2]) {
+    constexpr uint64_t SLOTS(0x249249249249ull); // Bit 0 of each 3 bit slot
+    auto lo = _pdep_u64(bitplane(group, 0), SLOTS);
+    auto hi = _pdep_u64(bitplane(group, 1), SLOTS);
+    auto nz = lo | hi;
+    auto mask = SLOTS | (nz << 1) | (hi << 2);
+    return { setbits16(mask), _pext_u64(nz | (hi << 1) | (lo << 2), mask) };
+}
+#endif
+
+template <typename T, typename S>
+static void groupencode(T group[B2], T maxval, S& s, uint64_t acc, size_t abits)
 {
     assert(abits <= 64);
     const size_t rung = topbit(maxval | 1);
     if (0 == rung) { // only 1s and 0s, rung is -1 or 0
         acc |= static_cast<uint64_t>(maxval) << abits++;
-        if (0 != maxval)
+        if (0 != maxval) {
+#if defined(__BMI2__)
+            acc |= bitplane(group, 0) << abits;
+            abits += B2;
+#else
             for (int i = 0; i < B2; i++)
                 acc |= static_cast<uint64_t>(group[i]) << abits++;
+#endif
+        }
         s.push(acc, abits);
         return;
     }
@@ -169,6 +245,13 @@ static void groupencode(T group[B2], T maxval, oBits& s, uint64_t acc, size_t ab
         s.push(acc, abits);
         acc = abits = 0;
     }
+#if defined(__BMI2__)
+    if (1 == rung) { // All 16 codewords at once, fits in 48 bits
+        auto c = rung1(group);
+        s.push(acc | (c.val << abits), abits + c.len);
+    }
+    else
+#endif
     if (6 > rung) { // Half of the group fits in 64 bits
         auto t = CRG[rung];
         for (size_t i = 0; i < B2 / 2; i++) {
@@ -205,32 +288,16 @@ static void groupencode(T group[B2], T maxval, oBits& s, uint64_t acc, size_t ab
     }
     // Computed encoding, slower, works for rung > 1
     else if (1 < sizeof(T)) { // This vanishes in 8 bit mode
-        if (sizeof(T) < 8 || rung < 31) { // low rung, can reuse acc
+        if (sizeof(T) < 8 || rung < 63)
+            hencode(group, rung, s, acc, abits);
+        else { // rung 63 might overflow 64 bits
+            s.push(acc, abits);
             for (int i = 0; i < B2; i++) {
                 auto p = qb3csz(group[i], rung);
-                if (p.first + abits > 64) {
-                    s.push(acc, abits);
-                    acc = abits = 0;
-                }
-                acc |= p.second << abits;
-                abits += p.first;
-            }
-            s.push(acc, abits);
-        }
-        else { // sizeof(T) == 8
-            s.push(acc, abits);
-            if (rung < 63) { // high rung, no overflow
-                for (int i = 0; i < B2; i++)
-                    s.push(qb3csz(group[i], rung));
-            }
-            else { // rung 63 might overflow 64 bits
-                for (int i = 0; i < B2; i++) {
-                    auto p = qb3csz(group[i], rung);
-                    size_t ovf = p.first & (p.first >> 6); // overflow
-                    s.push(p.second, p.first ^ ovf); // changes 65 in 64
-                    if (ovf)
-                        s.push(1ull & (static_cast<uint64_t>(group[i]) >> 62), ovf);
-                }
+                size_t ovf = p.len & (p.len >> 6); // overflow
+                s.push(p.val, p.len ^ ovf); // changes 65 in 64
+                if (ovf)
+                    s.push(1ull & (static_cast<uint64_t>(group[i]) >> 62), ovf);
             }
         }
     }
@@ -239,16 +306,16 @@ static void groupencode(T group[B2], T maxval, oBits& s, uint64_t acc, size_t ab
 }
 
 // Base QB3 group encode with code switch, returns encoded size
-template <typename T>
-static void groupencode(T group[B2], T maxval, size_t oldrung, oBits& s) {
+template <typename T, typename S>
+static void groupencode(T group[B2], T maxval, size_t oldrung, S& s) {
     constexpr size_t UBITS = sizeof(T) == 1 ? 3 : sizeof(T) == 2 ? 4 : sizeof(T) == 4 ? 5 : 6;
     uint64_t acc = CSW[UBITS][(topbit(maxval | 1) - oldrung) & ((1ull << UBITS) - 1)];
     groupencode(group, maxval, s, acc & TBLMASK, static_cast<size_t>(acc >> 12));
 }
 
 // Group encode with cf
-template <typename T>
-static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, oBits& bits) {
+template <typename T, typename S>
+static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, S& bits) {
     // Signal as switch to same rung, max-positive value, by UBITS
     const uint16_t SIGNAL[] = { 0x0, 0x0, 0x0, 0x5017, 0x6037, 0x7077, 0x80f7 };
     constexpr size_t UBITS = sizeof(T) == 1 ? 3 : sizeof(T) == 2 ? 4 : sizeof(T) == 4 ? 5 : 6;
@@ -260,7 +327,7 @@ static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, oBits& bits) {
     T maxval = 0;
     T group[B2] = {};
     for (size_t i = 0; i < B2; i++) if (igrp[i])
-        maxval = std::max(maxval, group[i] = magsdiv(igrp[i], cf));
+        maxval = vmax(maxval, group[i] = magsdiv(igrp[i], cf));
             //T(((magsabs(igrp[i]) / cf) << 1) - (igrp[i] & 1)));
     cf -= 2; // Bias down, 0 and 1 are not used
     auto trung = topbit(maxval | 1); // rung for the group values
@@ -286,8 +353,8 @@ static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, oBits& bits) {
             }
             auto p = qb3csztbl(cf, trung);
             bits.push(acc, abits); // could overflow, safter this way
-            acc = p.second;
-            abits = p.first;
+            acc = p.val;
+            abits = p.len;
         }
         else {
             // cf encoded with own rung, encoded as difference from trung
@@ -296,12 +363,12 @@ static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, oBits& bits) {
             abits += cs >> 12;
             // Followed by cf itself, encoded one rung under where it should be
             auto p = qb3csztbl(cf ^ (1ull << cfrung), cfrung - 1);
-            if (p.first + abits > 64) {
+            if (p.len + abits > 64) {
                 bits.push(acc, abits);
                 acc = abits = 0;
             }
-            acc |= p.second << abits;
-            abits += p.first;
+            acc |= p.val << abits;
+            abits += p.len;
             // For trung == 0, save the flag bit, can't be all zeros
             if (0 == trung) {
                 if (abits + B2 > 64) { // Large CF
@@ -328,6 +395,279 @@ static void cfgenc(const T igrp[B2], T cf, T pcf, size_t oldrung, oBits& bits) {
     groupencode(group, maxval, bits, acc, abits);
 }
 
+namespace { // Built for more than one instruction set, keep it local
+// Quantizes the source values as they are read, S is the source type, which can be signed
+// Rounds to nearest, ties go to zero or away from zero. Integer division is slow, so values
+// up to 32 bits are divided by multiplying with the round up reciprocal (Granlund-Montgomery)
+template<typename S> struct quantizer {
+    typedef typename std::make_unsigned<S>::type T;
+    static constexpr bool identity = false;
+
+    quantizer(size_t quanta, bool away) : q(static_cast<T>(quanta)),
+        half(static_cast<T>(away ? (quanta - 1) / 2 : quanta / 2)),
+        shift(topbit(quanta - 1)), magic(0)
+    {
+        if (sizeof(T) < 8) // 32 bit magic, 2^(shift + 1) is at least quanta
+            magic = static_cast<uint32_t>((((2ull << shift) - quanta) << 32) / quanta + 1);
+    }
+
+    T operator()(T v) const {
+        bool neg = std::is_signed<S>::value && static_cast<S>(v) < 0;
+        T a = neg ? T(0) - v : v; // magnitude
+        T d = div(a);
+        d += (a - d * q) > half;
+        return neg ? T(0) - d : d;
+    }
+
+#if defined(__AVX2__)
+    // Same, for eight values up to 32 bits, in the low bits of each 32 bit lane
+    // The results are also in the low bits, the rest of the lane is zero
+    __m256i operator()(__m256i v) const {
+        const int bits = 32 - 8 * static_cast<int>(sizeof(T));
+        auto neg = _mm256_setzero_si256();
+        if (std::is_signed<S>::value) { // Sign extend, then take the magnitude
+            v = _mm256_srai_epi32(_mm256_slli_epi32(v, bits), bits);
+            neg = _mm256_srai_epi32(v, 31);
+            v = _mm256_sub_epi32(_mm256_xor_si256(v, neg), neg);
+        }
+        else if (bits) {
+            v = _mm256_srli_epi32(_mm256_slli_epi32(v, bits), bits);
+        }
+        // High half of the product with the magic, for the even and the odd lanes
+        const auto m = _mm256_set1_epi32(static_cast<int>(magic));
+        auto t = _mm256_blend_epi32(_mm256_srli_epi64(_mm256_mul_epu32(v, m), 32),
+            _mm256_mul_epu32(_mm256_srli_epi64(v, 32), m), 0xaa);
+        t = _mm256_add_epi32(t, _mm256_srli_epi32(_mm256_sub_epi32(v, t), 1));
+        auto d = _mm256_srl_epi32(t, _mm_cvtsi32_si128(static_cast<int>(shift)));
+        // Round up when the remainder is above half, the compare is unsigned
+        auto r = _mm256_sub_epi32(v, _mm256_mullo_epi32(d, _mm256_set1_epi32(static_cast<int>(q))));
+        auto h = _mm256_set1_epi32(static_cast<int>(half + 1));
+        d = _mm256_sub_epi32(d, _mm256_cmpeq_epi32(_mm256_max_epu32(r, h), r));
+        d = _mm256_sub_epi32(_mm256_xor_si256(d, neg), neg);
+        return bits ? _mm256_srli_epi32(_mm256_slli_epi32(d, bits), bits) : d;
+    }
+#endif
+
+private:
+    T div(T a) const {
+        if (sizeof(T) == 8)
+            return a / q;
+        uint32_t t = static_cast<uint32_t>((uint64_t(magic) * a) >> 32);
+        return static_cast<T>((t + ((static_cast<uint32_t>(a) - t) >> 1)) >> shift);
+    }
+
+    T q, half; // Remainders above half round up
+    size_t shift;
+    uint32_t magic;
+};
+} // namespace
+
+// Collect the block at loc for band c, as running delta mag-sign values in scan order
+// cb is the core band, prv is the running previous value. Returns the max value
+// The source values are passed through load, which can quantize them
+template<typename T, typename L = raw<T>>
+static T collect(const T* image, const size_t offset[B2], size_t c, size_t cb, T& prv, T group[B2],
+    const L& load = L())
+{
+    T maxval(0);
+    // Use separate loop for basebands to avoid a test inside the hot loop
+    if (c != cb) {
+        for (size_t i = 0; i < B2; i++) {
+            T g = load(image[c + offset[i]]) - load(image[cb + offset[i]]);
+            prv += g -= prv;
+            group[i] = g = mags(g);
+            if (maxval < g) maxval = g;
+        }
+    }
+    else { // baseband
+        for (size_t i = 0; i < B2; i++) {
+            T g = load(image[c + offset[i]]);
+            prv += g -= prv;
+            group[i] = g = mags(g);
+            if (maxval < g) maxval = g;
+        }
+    }
+    return maxval;
+}
+
+#if defined(__AVX2__)
+// Vector block collection, 8 bit uses row loads and byte shuffles, the others use gathers
+// The vector reads can go past the block, so blocks too close to the end of the image use collect()
+namespace { // Built for more than one instruction set, keep it local
+struct vctx {
+    alignas(32) int32_t idx[B2]; // Block value offsets, in scan order
+    alignas(16) uint8_t shuf[4][B][B2]; // 8 bit shuffles from each row to scan order, by band
+    size_t line; // Line length, in values
+    size_t reach; // Values read past the block location
+    size_t size; // Image size, in values
+
+    vctx(const encs& info, const size_t offset[B2], size_t tsz) {
+        line = info.xsize * info.nbands;
+        size = line * info.ysize;
+        reach = 0;
+        for (size_t i = 0; i < B2; i++) {
+            idx[i] = static_cast<int32_t>(offset[i]);
+            reach = vmax(reach, offset[i] + info.nbands);
+        }
+        if (2 == tsz)
+            reach++; // 32 bit gather
+        if (1 == tsz) {
+            reach = info.nbands > 4 ? size + 1 : 3 * line + 16; // 16 byte row loads
+            for (size_t c = 0; c < 4; c++)
+                for (size_t j = 0; j < B; j++)
+                    for (size_t i = 0; i < B2; i++)
+                        shuf[c][j][i] = (offset[i] / line != j) ? 0x80 :
+                            static_cast<uint8_t>(offset[i] % line + c);
+        }
+    }
+
+    bool fits(size_t loc) const { return loc + reach <= size; }
+};
+} // namespace
+
+// The source values are passed through load, same as for collect()
+template<typename L>
+static uint8_t vcollect(const uint8_t* image, size_t c, size_t cb, const vctx& vc, uint8_t& prv, uint8_t group[B2],
+    const L& load)
+{
+    const __m128i rows[B] = {
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(image)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(image + vc.line)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(image + 2 * vc.line)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(image + 3 * vc.line)) };
+    auto gather = [&](size_t b) {
+        auto s = reinterpret_cast<const __m128i*>(vc.shuf[b]);
+        auto v = _mm_or_si128(
+            _mm_or_si128(_mm_shuffle_epi8(rows[0], _mm_load_si128(s)), _mm_shuffle_epi8(rows[1], _mm_load_si128(s + 1))),
+            _mm_or_si128(_mm_shuffle_epi8(rows[2], _mm_load_si128(s + 2)), _mm_shuffle_epi8(rows[3], _mm_load_si128(s + 3))));
+        if (L::identity)
+            return v;
+        // Widen to 32 bits, the packs are per lane
+        auto l = load(_mm256_cvtepu8_epi32(v));
+        auto h = load(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+        auto w = _mm256_permute4x64_epi64(_mm256_packus_epi32(l, h), _MM_SHUFFLE(3, 1, 2, 0));
+        return _mm_packus_epi16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+    };
+    auto v = gather(c);
+    if (c != cb)
+        v = _mm_sub_epi8(v, gather(cb));
+    // Delta from the previous value in scan order
+    auto d = _mm_sub_epi8(v, _mm_alignr_epi8(v, _mm_set1_epi8(static_cast<char>(prv)), 15));
+    prv = static_cast<uint8_t>(_mm_extract_epi8(v, 15));
+    d = _mm_xor_si128(_mm_add_epi8(d, d), _mm_cmpgt_epi8(_mm_setzero_si128(), d)); // mags
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(group), d);
+    d = _mm_max_epu8(d, _mm_srli_si128(d, 8));
+    d = _mm_max_epu8(d, _mm_srli_si128(d, 4));
+    d = _mm_max_epu8(d, _mm_srli_si128(d, 2));
+    d = _mm_max_epu8(d, _mm_srli_si128(d, 1));
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(d));
+}
+
+template<typename L>
+static uint16_t vcollect(const uint16_t* image, size_t c, size_t cb, const vctx& vc, uint16_t& prv, uint16_t group[B2],
+    const L& load)
+{
+    const auto lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(vc.idx));
+    const auto hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(vc.idx + 8));
+    auto gather = [&](size_t b) {
+        auto base = reinterpret_cast<const int*>(image + b);
+        const auto mask = _mm256_set1_epi32(0xffff);
+        auto l = load(_mm256_and_si256(_mm256_i32gather_epi32(base, lo, 2), mask));
+        auto h = load(_mm256_and_si256(_mm256_i32gather_epi32(base, hi, 2), mask));
+        // The pack is per lane, put the 64bit parts back in order
+        return _mm256_permute4x64_epi64(_mm256_packus_epi32(l, h), _MM_SHUFFLE(3, 1, 2, 0));
+    };
+    auto v = gather(c);
+    if (c != cb)
+        v = _mm256_sub_epi16(v, gather(cb));
+    // Previous value in scan order, shift by one value across the lanes
+    auto p = _mm256_alignr_epi8(v, _mm256_permute2x128_si256(v, v, 0x08), 14);
+    auto d = _mm256_sub_epi16(v, _mm256_insert_epi16(p, static_cast<short>(prv), 0));
+    prv = static_cast<uint16_t>(_mm256_extract_epi16(v, 15));
+    d = _mm256_xor_si256(_mm256_add_epi16(d, d), _mm256_srai_epi16(d, 15)); // mags
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(group), d);
+    // Max of unsigned is the complement of the min of the complements
+    auto m = _mm_max_epu16(_mm256_castsi256_si128(d), _mm256_extracti128_si256(d, 1));
+    m = _mm_minpos_epu16(_mm_xor_si128(m, _mm_set1_epi32(-1)));
+    return static_cast<uint16_t>(~_mm_cvtsi128_si32(m));
+}
+
+template<typename L>
+static uint32_t vcollect(const uint32_t* image, size_t c, size_t cb, const vctx& vc, uint32_t& prv, uint32_t group[B2],
+    const L& load)
+{
+    const auto lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(vc.idx));
+    const auto hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(vc.idx + 8));
+    auto base = reinterpret_cast<const int*>(image);
+    auto v0 = load(_mm256_i32gather_epi32(base + c, lo, 4));
+    auto v1 = load(_mm256_i32gather_epi32(base + c, hi, 4));
+    if (c != cb) {
+        v0 = _mm256_sub_epi32(v0, load(_mm256_i32gather_epi32(base + cb, lo, 4)));
+        v1 = _mm256_sub_epi32(v1, load(_mm256_i32gather_epi32(base + cb, hi, 4)));
+    }
+    // Previous value in scan order, rotate by one and fill in the first one
+    const auto rot = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    auto r0 = _mm256_permutevar8x32_epi32(v0, rot);
+    auto r1 = _mm256_permutevar8x32_epi32(v1, rot);
+    auto d0 = _mm256_sub_epi32(v0, _mm256_blend_epi32(r0, _mm256_set1_epi32(static_cast<int>(prv)), 1));
+    auto d1 = _mm256_sub_epi32(v1, _mm256_blend_epi32(r1, r0, 1));
+    prv = static_cast<uint32_t>(_mm256_extract_epi32(v1, 7));
+    d0 = _mm256_xor_si256(_mm256_add_epi32(d0, d0), _mm256_srai_epi32(d0, 31)); // mags
+    d1 = _mm256_xor_si256(_mm256_add_epi32(d1, d1), _mm256_srai_epi32(d1, 31));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(group), d0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(group + 8), d1);
+    d0 = _mm256_max_epu32(d0, d1);
+    auto m = _mm_max_epu32(_mm256_castsi256_si128(d0), _mm256_extracti128_si256(d0, 1));
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(m));
+}
+
+// The 64 bit values are quantized one at a time, there is no vector division
+template<typename L>
+static uint64_t vcollect(const uint64_t* image, size_t c, size_t cb, const vctx& vc, uint64_t& prv, uint64_t group[B2],
+    const L& load)
+{
+    auto base = reinterpret_cast<const long long*>(image);
+    auto gather = [&](size_t b, __m128i idx) {
+        auto v = _mm256_i32gather_epi64(base + b, idx, 8);
+        if (L::identity)
+            return v;
+        alignas(32) uint64_t t[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(t), v);
+        for (auto& x : t)
+            x = load(x);
+        return _mm256_load_si256(reinterpret_cast<const __m256i*>(t));
+    };
+    __m256i v[B];
+    for (size_t j = 0; j < B; j++) {
+        auto idx = _mm_load_si128(reinterpret_cast<const __m128i*>(vc.idx + 4 * j));
+        v[j] = gather(c, idx);
+        if (c != cb)
+            v[j] = _mm256_sub_epi64(v[j], gather(cb, idx));
+    }
+    // Previous value in scan order, rotate by one and fill in the first one
+    auto p = _mm256_set1_epi64x(static_cast<long long>(prv));
+    const auto sign = _mm256_set1_epi64x(static_cast<long long>(1ull << 63));
+    auto m = _mm256_setzero_si256();
+    for (size_t j = 0; j < B; j++) {
+        auto r = _mm256_permute4x64_epi64(v[j], _MM_SHUFFLE(2, 1, 0, 3));
+        auto d = _mm256_sub_epi64(v[j], _mm256_blend_epi32(r, p, 0x3));
+        p = r;
+        d = _mm256_xor_si256(_mm256_add_epi64(d, d), _mm256_cmpgt_epi64(_mm256_setzero_si256(), d)); // mags
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(group + 4 * j), d);
+        // Unsigned max, flip the sign bit for the comparison
+        auto gt = _mm256_cmpgt_epi64(_mm256_xor_si256(d, sign), _mm256_xor_si256(m, sign));
+        m = _mm256_blendv_epi8(m, d, gt);
+    }
+    prv = static_cast<uint64_t>(_mm256_extract_epi64(v[B - 1], 3));
+    alignas(32) uint64_t mv[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(mv), m);
+    return vmax(vmax(mv[0], mv[1]), vmax(mv[2], mv[3]));
+}
+
+#endif // __AVX2__
+
 // Check that the parameters are valid
 static int check_info(const encs& info) {
     if (info.xsize < 4 || info.xsize > 0x10000 || info.ysize < 4 || info.ysize > 0x10000
@@ -340,9 +680,9 @@ static int check_info(const encs& info) {
     return 0;
 }
 
-// Only basic encoding
-template<typename T>
-static int encode_fast(const T* image, oBits& s, encs &info)
+// Only basic encoding, S is the output bitstream, cBits only counts the bits
+template<typename T, typename S, typename L = raw<T>>
+static int encode_fast(const T* image, S& s, encs &info, const L& load = L())
 {
     static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "Only unsigned integer types allowed");
     if (check_info(info))
@@ -368,6 +708,9 @@ static int encode_fast(const T* image, oBits& s, encs &info)
         size_t n = (order >> ((B2 - 1 - i) << 2));
         offset[i] = (xsize * ((n >> 2) & 0b11) + (n & 0b11)) * bands;
     }
+#if defined(__AVX2__)
+    const vctx vc(info, offset, sizeof(T));
+#endif
     T group[B2] = {};
     for (size_t y = 0; y < ysize; y += B) {
         // If the last row is partial, roll it up
@@ -379,28 +722,14 @@ static int encode_fast(const T* image, oBits& s, encs &info)
                 x = xsize - B;                
             const size_t loc = (y * xsize + x) * bands; // Top-left pixel address
             for (size_t c = 0; c < bands; c++) { // blocks are band interleaved
-                T maxval(0); // Maximum mag-sign value within this group
                 // Collect the block for this band, convert to running delta mag-sign
-                auto prv = prev[c];
-                // Use separate loop for basebands to avoid a test inside the hot loop
-                if (c != cband[c]) {
-                    auto cb = cband[c];
-                    for (size_t i = 0; i < B2; i++) {
-                        T g = image[loc + c + offset[i]] - image[loc + cb + offset[i]];
-                        prv += g -= prv;
-                        group[i] = g = mags(g);
-                        if (maxval < g) maxval = g;
-                    }
-                }
-                else { // baseband
-                    for (size_t i = 0; i < B2; i++) {
-                        T g = image[loc + c + offset[i]];
-                        prv += g -= prv;
-                        group[i] = g = mags(g);
-                        if (maxval < g) maxval = g;
-                    }
-                }
-                prev[c] = prv;
+                // Maximum mag-sign value within this group
+#if defined(__AVX2__)
+                const T maxval = vc.fits(loc) ? vcollect(image + loc, c, cband[c], vc, prev[c], group, load)
+                    : collect(image + loc, offset, c, cband[c], prev[c], group, load);
+#else
+                const T maxval = collect(image + loc, offset, c, cband[c], prev[c], group, load);
+#endif
                 groupencode(group, maxval, runbits[c], s);
                 runbits[c] = topbit(maxval | 1);
             }
@@ -415,8 +744,8 @@ static int encode_fast(const T* image, oBits& s, encs &info)
 }
 
 // Index based encoding
-template<typename T>
-static int ienc(const T grp[B2], size_t rung, size_t oldrung, oBits &s) {
+template<typename T, typename S>
+static int ienc(const T grp[B2], size_t rung, size_t oldrung, S& s) {
     constexpr int TOO_LARGE(800); // Larger than any possible size
     if (rung < 4 || rung == 63) // TODO: encode rung 63
         return TOO_LARGE;
@@ -458,7 +787,14 @@ static int ienc(const T grp[B2], size_t rung, size_t oldrung, oBits &s) {
     abits += static_cast<size_t>((cs >> 12) - 1);
     s.push(acc, abits);
     acc = abits = 0;
-    std::sort(v, v + len, [](const KVP& a, const KVP& b) { return a.count > b.count; });
+    // Most frequent first, insertion sort keeps ties in order and there are at most 8 entries
+    for (size_t i = 1; i < len; i++) {
+        auto kv = v[i];
+        size_t j = i;
+        for (; j > 0 && kv.count > v[j - 1].count; j--)
+            v[j] = v[j - 1];
+        v[j] = kv;
+    }
 
     // Encode indices
     for (int i = 0; i < B2; i++) {
@@ -478,8 +814,8 @@ static int ienc(const T grp[B2], size_t rung, size_t oldrung, oBits &s) {
 
 // Returns error code or 0 if success
 // TODO: Error code mapping
-template <typename T = uint8_t>
-static int encode_best(const T *image, oBits& s, encs &info)
+template <typename T, typename S, typename L = raw<T>>
+static int encode_best(const T *image, S& s, encs &info, const L& load = L())
 {
     static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "Only unsigned integer types allowed");
     if (check_info(info))
@@ -506,6 +842,9 @@ static int encode_best(const T *image, oBits& s, encs &info)
         size_t n = (order >> ((B2 - 1 - i) << 2));
         offset[i] = (xsize * ((n >> 2) & 0b11) + (n & 0b11)) * bands;
     }
+#if defined(__AVX2__)
+    const vctx vc(info, offset, sizeof(T));
+#endif
     T group[B2] = {}; // 2D group to encode
     for (size_t y = 0; y < ysize; y += B) {
         // If the last row is partial, roll it up
@@ -517,27 +856,14 @@ static int encode_best(const T *image, oBits& s, encs &info)
                 x = xsize - B;
             size_t loc = (y * xsize + x) * bands; // Top-left pixel address
             for (size_t c = 0; c < bands; c++) { // blocks are always band interleaved
-                T maxval(0); // Maximum mag-sign value within this group
                 // Collect the block for this band, convert to running delta mag-sign
-                auto prv = prev[c];
-                if (c != cband[c]) {
-                    auto cb = cband[c];
-                    for (size_t i = 0; i < B2; i++) {
-                        T g = image[loc + c + offset[i]] - image[loc + cb + offset[i]];
-                        prv += g -= prv;
-                        group[i] = g = mags(g);
-                        if (maxval < g) maxval = g;
-                    }
-                }
-                else {
-                    for (size_t i = 0; i < B2; i++) {
-                        T g = image[loc + c + offset[i]];
-                        prv += g -= prv;
-                        group[i] = g = mags(g);
-                        if (maxval < g) maxval = g;
-                    }
-                }
-                prev[c] = prv;
+                // Maximum mag-sign value within this group
+#if defined(__AVX2__)
+                const T maxval = vc.fits(loc) ? vcollect(image + loc, c, cband[c], vc, prev[c], group, load)
+                    : collect(image + loc, offset, c, cband[c], prev[c], group, load);
+#else
+                const T maxval = collect(image + loc, offset, c, cband[c], prev[c], group, load);
+#endif
                 auto oldrung = runbits[c];
                 const size_t rung = topbit(maxval | 1);
                 runbits[c] = rung;
@@ -546,9 +872,15 @@ static int encode_best(const T *image, oBits& s, encs &info)
                     size_t abits = acc >> 12;
                     acc &= TBLMASK;
                     acc |= static_cast<uint64_t>(maxval) << abits++; // Add the all-zero flag
-                    if (0 != maxval)
+                    if (0 != maxval) {
+#if defined(__BMI2__)
+                        acc |= bitplane(group, 0) << abits;
+                        abits += B2;
+#else
                         for (size_t i = 0; i < B2; i++)
                             acc |= static_cast<uint64_t>(group[i]) << abits++;
+#endif
+                    }
                     s.push(acc, abits);
                     continue;
                 }
@@ -0,0 +1,270 @@
+/*
+Content: QB3 encoding and decoding kernels, instruction set dispatch
+
+Copyright 2024 Esri
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Contributors:  Lucian Plesea
+*/
+
+// This file is compiled once for each supported instruction set, with QB3_KERNELS
+// defined as the name of the kernel table and the matching compiler flags.
+// The baseline build, without QB3_KERNELS, also holds the runtime selection.
+// Everything in here and in the included headers has to have internal linkage,
+// otherwise the linker might pick a copy built for a different instruction set
+// That includes std templates such as std::max or std::pair, their instances are shared,
+// so the headers use local replacements. Check with nm on a Debug build
+
+#pragma warning(disable:4127) // conditional expression is constant
+#include "QB3encode.h"
+#include "QB3decode.h"
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(QB3_KERNELS)
+#define QB3_KERNELS qb3_kernels_base
+#define QB3_DISPATCH
+#endif
+
+// Encode by data type, the signed types are encoded as unsigned
+// When quantizing, the values are divided as the blocks are collected, T is the source type
+template<typename T, typename S>
+static int encode(const void* image, S& s, encs& info, bool best) {
+    typedef typename std::make_unsigned<T>::type U;
+    auto src = static_cast<const U*>(image);
+    if (info.quanta < 2)
+        return best ? QB3::encode_best(src, s, info) : QB3::encode_fast(src, s, info);
+    const QB3::quantizer<T> load(info.quanta, info.away);
+    return best ? QB3::encode_best(src, s, info, load) : QB3::encode_fast(src, s, info, load);
+}
+
+template<typename S>
+static int encode(const void* image, S& s, encs& info, bool best) {
+    int error(QB3E_EINV);
+#define ENC(T) error = encode<T>(image, s, info, best)
+    switch (info.type) {
+    case qb3_dtype::QB3_U8:  ENC(uint8_t); break;
+    case qb3_dtype::QB3_I8:  ENC(int8_t); break;
+    case qb3_dtype::QB3_U16: ENC(uint16_t); break;
+    case qb3_dtype::QB3_I16: ENC(int16_t); break;
+    case qb3_dtype::QB3_U32: ENC(uint32_t); break;
+    case qb3_dtype::QB3_I32: ENC(int32_t); break;
+    case qb3_dtype::QB3_U64: ENC(uint64_t); break;
+    case qb3_dtype::QB3_I64: ENC(int64_t); break;
+    default:
+        break; // Invalid type
+    } // data type
+#undef ENC
+    return error;
+}
+
+// Without an output, only the bits are counted
+static int encode(const void* image, uint8_t* out, size_t& pos, encs& info, bool best) {
+    int error;
+    if (out) {
+        oBits s(out, pos);
+        error = encode(image, s, info, best);
+        pos = s.position();
+    }
+    else {
+        cBits s(pos);
+        error = encode(image, s, info, best);
+        pos = s.position();
+    }
+    return error;
+}
+
+// Decode by type, the signed types are decoded as unsigned
+// When quantized, the values are multiplied as the blocks are stored, sign is the output type signedness
+template<typename T>
+static bool decode(uint8_t* src, size_t len, void* image, const decs& info, bool sign) {
+    auto dst = static_cast<T*>(image);
+    if (info.quanta < 2)
+        return QB3::decode(src, len, dst, info);
+    return QB3::decode(src, len, dst, info, QB3::dequantizer<T>(info.quanta, sign));
+}
+
+// Decode by data type, returns true on failure
+static bool decode(uint8_t* src, size_t len, void* image, const decs& info) {
+#define DEC(T, S) return decode<T>(src, len, image, info, S)
+    switch (info.type) {
+    case qb3_dtype::QB3_U8:  DEC(uint8_t, false);
+    case qb3_dtype::QB3_I8:  DEC(uint8_t, true);
+    case qb3_dtype::QB3_U16: DEC(uint16_t, false);
+    case qb3_dtype::QB3_I16: DEC(uint16_t, true);
+    case qb3_dtype::QB3_U32: DEC(uint32_t, false);
+    case qb3_dtype::QB3_I32: DEC(uint32_t, true);
+    case qb3_dtype::QB3_U64: DEC(uint64_t, false);
+    case qb3_dtype::QB3_I64: DEC(uint64_t, true);
+    default:
+        return true; // Invalid type
+    } // data type
+#undef DEC
+}
+
+template<typename T>
+static bool window(uint8_t* src, size_t len, const decs& info, size_t top, size_t y0, size_t y1,
+    size_t x0, size_t w, void* dest, size_t stride, void* buffer, bool sign)
+{
+    auto dst = static_cast<T*>(dest);
+    auto buf = static_cast<T*>(buffer);
+    if (info.quanta < 2)
+        return QB3::decode_window(src, len, info, top, y0, y1, x0, w, dst, stride, buf);
+    return QB3::decode_window(src, len, info, top, y0, y1, x0, w, dst, stride, buf,
+        QB3::dequantizer<T>(info.quanta, sign));
+}
+
+// Window decode by data type, returns true on failure
+static bool window(uint8_t* src, size_t len, const decs& info, size_t top, size_t y0, size_t y1,
+    size_t x0, size_t w, void* dest, size_t stride, void* buffer)
+{
+#define DEC(T, S) return window<T>(src, len, info, top, y0, y1, x0, w, dest, stride, buffer, S)
+    switch (info.type) {
+    case qb3_dtype::QB3_U8:  DEC(uint8_t, false);
+    case qb3_dtype::QB3_I8:  DEC(uint8_t, true);
+    case qb3_dtype::QB3_U16: DEC(uint16_t, false);
+    case qb3_dtype::QB3_I16: DEC(uint16_t, true);
+    case qb3_dtype::QB3_U32: DEC(uint32_t, false);
+    case qb3_dtype::QB3_I32: DEC(uint32_t, true);
+    case qb3_dtype::QB3_U64: DEC(uint64_t, false);
+    case qb3_dtype::QB3_I64: DEC(uint64_t, true);
+    default:
+        return true; // Invalid type
+    } // data type
+#undef DEC
+}
+
+template<typename T>
+static bool row(iBits& s, void* image, size_t stride, const size_t offset[B2], const decs& info,
+    band_state* state, bool sign)
+{
+    auto dst = static_cast<T*>(image);
+    if (info.quanta < 2)
+        return QB3::decode_row(s, dst, stride, offset, info, state);
+    return QB3::decode_row(s, dst, stride, offset, info, state, QB3::dequantizer<T>(info.quanta, sign));
+}
+
+// Row of blocks decode by data type, returns true on failure
+static bool row(uint8_t* src, size_t len, size_t& pos, void* image, size_t stride, const decs& info,
+    band_state* state)
+{
+    size_t offset[B2] = {};
+    QB3::block_offsets(info.order, stride, info.nbands, offset);
+    iBits s(src, len);
+    s.advance(pos);
+    bool failed(true); // Invalid type
+#define DEC(T, S) failed = row<T>(s, image, stride, offset, info, state, S)
+    switch (info.type) {
+    case qb3_dtype::QB3_U8:  DEC(uint8_t, false); break;
+    case qb3_dtype::QB3_I8:  DEC(uint8_t, true); break;
+    case qb3_dtype::QB3_U16: DEC(uint16_t, false); break;
+    case qb3_dtype::QB3_I16: DEC(uint16_t, true); break;
+    case qb3_dtype::QB3_U32: DEC(uint32_t, false); break;
+    case qb3_dtype::QB3_I32: DEC(uint32_t, true); break;
+    case qb3_dtype::QB3_U64: DEC(uint64_t, false); break;
+    case qb3_dtype::QB3_I64: DEC(uint64_t, true); break;
+    default:
+        break;
+    } // data type
+#undef DEC
+    pos = s.position();
+    return failed;
+}
+
+extern const qb3_kernels QB3_KERNELS = { encode, decode, window, row };
+
+#if defined(QB3_DISPATCH)
+// The other kernel tables, when built
+#if defined(QB3_HAVE_SSE4)
+extern const qb3_kernels qb3_kernels_sse4;
+#endif
+#if defined(QB3_HAVE_AVX2)
+extern const qb3_kernels qb3_kernels_avx2;
+#endif
+#if defined(QB3_HAVE_AVX512)
+extern const qb3_kernels qb3_kernels_avx512;
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+enum isa_level { ISA_BASE, ISA_SSE4, ISA_AVX2, ISA_AVX512 };
+
+// Highest instruction set level supported by this CPU
+static isa_level cpu_level() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("sse4.2") || !__builtin_cpu_supports("popcnt"))
+        return ISA_BASE;
+    if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("bmi")
+        || !__builtin_cpu_supports("bmi2"))
+        return ISA_SSE4;
+    if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw")
+        || !__builtin_cpu_supports("avx512vl"))
+        return ISA_AVX2;
+    return ISA_AVX512;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int r[4];
+    __cpuid(r, 0);
+    if (r[0] < 7)
+        return ISA_BASE;
+    __cpuid(r, 1);
+    if (!(r[2] & (1 << 20)) || !(r[2] & (1 << 23))) // SSE4.2, POPCNT
+        return ISA_BASE;
+    // OS has to save the AVX state
+    if (!(r[2] & (1 << 27)) || !(r[2] & (1 << 28)) || (_xgetbv(0) & 0x6) != 0x6)
+        return ISA_SSE4;
+    __cpuidex(r, 7, 0);
+    if (!(r[1] & (1 << 5)) || !(r[1] & (1 << 3)) || !(r[1] & (1 << 8))) // AVX2, BMI, BMI2
+        return ISA_SSE4;
+    if (!(r[1] & (1 << 16)) || !(r[1] & (1 << 30)) || !(r[1] & (1u << 31))
+        || (_xgetbv(0) & 0xe6) != 0xe6) // AVX512 F, BW and VL
+        return ISA_AVX2;
+    return ISA_AVX512;
+#else
+    return ISA_BASE;
+#endif
+}
+
+static const qb3_kernels* pick_kernels() {
+    struct { const char* name; isa_level level; const qb3_kernels* kernels; } available[] = {
+        { "base", ISA_BASE, &qb3_kernels_base },
+#if defined(QB3_HAVE_SSE4)
+        { "sse4", ISA_SSE4, &qb3_kernels_sse4 },
+#endif
+#if defined(QB3_HAVE_AVX2)
+        { "avx2", ISA_AVX2, &qb3_kernels_avx2 },
+#endif
+#if defined(QB3_HAVE_AVX512)
+        { "avx512", ISA_AVX512, &qb3_kernels_avx512 },
+#endif
+    };
+    auto level = cpu_level();
+    const qb3_kernels* best = &qb3_kernels_base;
+    for (auto& k : available)
+        if (k.level <= level)
+            best = k.kernels;
+    // Use the requested one, if this CPU can run it
+#pragma warning(suppress:4996) // getenv
+    const char* isa = getenv("QB3_ISA");
+    if (isa)
+        for (auto& k : available)
+            if (0 == strcmp(isa, k.name) && k.level <= level)
+                best = k.kernels;
+    return best;
+}
+
+const qb3_kernels* qb3_select_kernels() {
+    static const qb3_kernels* kernels(pick_kernels());
+    return kernels;
+}
+#endif
@@ -0,0 +1,180 @@
+/*
+Content: Library thread pool and host executor interface
+
+Copyright 2024 Esri
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Contributors:  Lucian Plesea
+*/
+
+#include "QB3common.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace {
+// Persistent worker threads, shared by all the parallel operations
+// The threads are created when needed and never joined, so the pool is never deleted
+class thread_pool {
+public:
+    thread_pool() : size(0), workers(0), idle(0), executor(nullptr), context(nullptr) {}
+
+    // Total number of threads, including the calling one
+    size_t threads() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return limit();
+    }
+
+    void set_threads(size_t n) {
+        std::lock_guard<std::mutex> lock(mtx);
+        size = n;
+        cv.notify_all(); // Extra workers exit
+    }
+
+    void set_executor(qb3_executor fn, void* ctx) {
+        std::lock_guard<std::mutex> lock(mtx);
+        executor = fn;
+        context = ctx;
+    }
+
+    // Runs task(arg) once, on another thread if possible
+    void run(qb3_task task, void* arg) {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (executor) {
+            auto fn = executor;
+            auto ctx = context;
+            lock.unlock();
+            fn(task, arg, ctx);
+            return;
+        }
+        queue.emplace_back(task, arg);
+        if (idle < queue.size() && workers + 1 < limit()) {
+            try {
+                std::thread(&thread_pool::work, this).detach();
+                workers++;
+            }
+            catch (...) {} // Not enough threads
+        }
+        if (0 == workers) { // Can't wait for a worker
+            queue.pop_back();
+            lock.unlock();
+            task(arg);
+            return;
+        }
+        cv.notify_one();
+    }
+
+private:
+    // Call with the lock held
+    size_t limit() const {
+        return size ? size : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mtx);
+        // Exit when the pool shrinks, the last one empties the queue first
+        while (workers < limit() || (1 == workers && !queue.empty())) {
+            if (queue.empty()) {
+                idle++;
+                cv.wait(lock);
+                idle--;
+                continue;
+            }
+            auto t = queue.front();
+            queue.pop_front();
+            lock.unlock();
+            t.first(t.second);
+            lock.lock();
+        }
+        workers--;
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::pair<qb3_task, void*>> queue;
+    size_t size;    // Requested number of threads, 0 for one per core
+    size_t workers; // Running worker threads
+    size_t idle;    // Workers waiting for a task
+    qb3_executor executor; // Host application executor, if set
+    void* context;
+};
+
+thread_pool& pool() {
+    static thread_pool* p(new thread_pool);
+    return *p;
+}
+
+// One parallel loop, shared by the calling thread and the helper tasks
+// Helpers which start after the loop is closed don't do anything, so the caller only
+// waits for the ones which started. It gets deleted by the last one to finish
+struct loop_state {
+    loop_state(size_t count, void (*fn)(void*, size_t), void* ctx)
+        : next(0), count(count), fn(fn), ctx(ctx), active(0), closed(false) {}
+
+    void work() {
+        for (size_t i = next++; i < count; i = next++)
+            fn(ctx, i);
+    }
+
+    std::atomic<size_t> next;
+    const size_t count;
+    void (* const fn)(void*, size_t);
+    void* const ctx;
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_t active; // Helpers running
+    bool closed;   // All done, no helper should start
+};
+
+void helper(void* arg) {
+    std::unique_ptr<std::shared_ptr<loop_state>> ref(static_cast<std::shared_ptr<loop_state>*>(arg));
+    auto& st = **ref;
+    {
+        std::lock_guard<std::mutex> lock(st.mtx);
+        if (st.closed)
+            return;
+        st.active++;
+    }
+    st.work();
+    std::lock_guard<std::mutex> lock(st.mtx);
+    if (0 == --st.active)
+        st.cv.notify_all();
+}
+} // namespace
+
+size_t qb3_threads(size_t threads) {
+    return threads ? threads : pool().threads();
+}
+
+void qb3_parallel(size_t count, size_t threads, void (*fn)(void*, size_t), void* ctx) {
+    threads = std::min(qb3_threads(threads), count);
+    if (threads < 2) { // In order, in this thread
+        for (size_t i = 0; i < count; i++)
+            fn(ctx, i);
+        return;
+    }
+    auto st = std::make_shared<loop_state>(count, fn, ctx);
+    for (size_t t = 1; t < threads; t++)
+        pool().run(helper, new std::shared_ptr<loop_state>(st));
+    st->work();
+    std::unique_lock<std::mutex> lock(st->mtx);
+    st->closed = true;
+    st->cv.wait(lock, [&]() { return 0 == st->active; });
+}
+
+void qb3_set_threads(size_t threads) {
+    pool().set_threads(threads);
+}
+
+void qb3_set_executor(qb3_executor executor, void* context) {
+    pool().set_executor(executor, context);
+}
@@ -22,6 +22,16 @@ Contributors:  Lucian Plesea
 #include <limits>
 #include <utility>
 
+// These get compiled with different instruction sets, see QB3kernels.cpp
+// Keep them local to each file, so the linker doesn't merge them
+namespace {
+// A codeword, as bit count and value, the bits are in the low part of the value
+// Used instead of std::pair, which isn't local to the file
+struct codeword {
+    size_t len;
+    uint64_t val;
+};
+
 // Input bitstream, doesn't go past size
 class iBits {
 public:
@@ -58,6 +68,10 @@ public:
         return val;
     }
 
+    // The byte holding the read position, for direct access
+    // Only safe when there are enough bytes available
+    const uint8_t* data() const { return v + bitp / 8; }
+
     // Not very efficient for small number of bits
     uint64_t pull(size_t bits = 1) {
         assert(bits && bits <= 64 && !empty());
@@ -76,7 +90,7 @@ private:
 // Output bitstream, doesn't check the output buffer size
 class oBits {
 public:
-    oBits(uint8_t * data) : v(data), bitp(0) {}
+    oBits(uint8_t * data, size_t pos = 0) : v(data), bitp(pos) {}
 
     // Number of bits written
     size_t position() const { return bitp; }
@@ -107,7 +121,7 @@ public:
         bitp += nbits;
     }
 
-    template<typename T> void push(std::pair<size_t, T> p) { push(p.second, p.first); }
+    void push(codeword c) { push(c.val, c.len); }
 
     // Append content from other output bitstream
     oBits& operator+=(const oBits&other) {
@@ -135,3 +149,41 @@ private:
     uint8_t *v;
     size_t bitp; // write position
 };
+
+// Output bitstream which only counts the bits, same interface as oBits
+class cBits {
+public:
+    cBits(size_t pos = 0) : bitp(pos) {}
+
+    size_t position() const { return bitp; }
+
+    size_t rewind(size_t pos = 0) {
+        if (pos < position())
+            bitp = pos;
+        return position();
+    }
+
+    template<typename T>
+    void push(T, size_t nbits) {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+            "Only works with unsigned integral types");
+        assert(nbits < 65);
+        bitp += nbits;
+    }
+
+    void push(codeword c) { bitp += c.len; }
+
+    cBits& operator+=(const oBits& other) {
+        bitp += other.position();
+        return *this;
+    }
+
+    size_t tobyte() {
+        bitp = (bitp + 7) & ~0x7;
+        return bitp >> 3;
+    }
+
+private:
+    size_t bitp;
+};
+} // namespace
@@ -206,6 +206,20 @@ def show_double2():
         out.append( ((v + v1) & 0xf000) + (v1 & 0x7) * 8 + (v & 0x7))
     print_table(out, "static const uint16_t DDRG2[] = {", "0x{:x}, ")
 
+def show_multi(rung, count):
+    'Multiple value decoding table, for count values at rung, index is as wide as the longest sequence'
+    single = tuple(decode(v, rung) for v in range(2 ** (rung + 2)))
+    out = []
+    for i in range(2 ** (count * (rung + 2))):
+        size = val = 0
+        for j in range(count):
+            v = single[(i >> size) & ((1 << (rung + 2)) - 1)]
+            val += (v & 0xff) << (j * (rung + 1))
+            size += v >> 12
+        # Total size in the top 4 bits, values are packed in the low bits
+        out.append((size << 12) + val)
+    print_table(out, f"static const uint16_t MDRG{rung}[] = {{", "0x{:x}, ")
+
 if __name__ == "__main__":
     #trycodec()
     #showencode()
@@ -218,4 +232,7 @@ if __name__ == "__main__":
 
     #showsame()
     #show_double1()
-    #show_double2()
\ No newline at end of file
+    #show_double2()
+    #show_multi(1, 4)
+    #show_multi(2, 3)
+    #show_multi(3, 2)
\ No newline at end of file
@@ -0,0 +1,845 @@
+/*
+Content: libQB3 API tests, without external dependencies
+
+Copyright 2024 Esri
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Contributors:  Lucian Plesea
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include "QB3lib/QB3.h"
+
+using namespace std;
+
+static int failures = 0;
+
+static void check(bool ok, const char* test, const char* what) {
+    if (ok)
+        return;
+    failures++;
+    fprintf(stderr, "%s: %s\n", test, what);
+}
+
+template<typename T> qb3_dtype dtype();
+template<> qb3_dtype dtype<uint8_t>() { return QB3_U8; }
+template<> qb3_dtype dtype<uint16_t>() { return QB3_U16; }
+template<> qb3_dtype dtype<uint32_t>() { return QB3_U32; }
+template<> qb3_dtype dtype<uint64_t>() { return QB3_U64; }
+template<> qb3_dtype dtype<int8_t>() { return QB3_I8; }
+template<> qb3_dtype dtype<int16_t>() { return QB3_I16; }
+template<> qb3_dtype dtype<int32_t>() { return QB3_I32; }
+template<> qb3_dtype dtype<int64_t>() { return QB3_I64; }
+
+// Test image, with smooth, noisy, flat and common factor bands of 8 lines
+template<typename T>
+vector<T> image(size_t xsize, size_t ysize, size_t bands, mt19937& rng) {
+    vector<T> img(xsize * ysize * bands);
+    for (size_t y = 0; y < ysize; y++) {
+        auto kind = (y / 8 + rng()) % 4;
+        for (size_t x = 0; x < xsize; x++)
+            for (size_t c = 0; c < bands; c++) {
+                T v;
+                switch (kind) {
+                case 0: v = T(x + y + c * 10 + rng() % 3); break;
+                case 1: v = T(rng() % 1000); break;
+                case 2: v = T(c + 7); break;
+                default: v = T(((x + 2 * y) % 19) * 8); break;
+                }
+                img[(y * xsize + x) * bands + c] = v;
+            }
+    }
+    return img;
+}
+
+// Encoder with the given settings, strips is the block rows per strip, 0 for a single strip
+template<typename T>
+encsp encoder(size_t xsize, size_t ysize, size_t bands, int mode, size_t strips = 0, size_t q = 1) {
+    auto p = qb3_create_encoder(xsize, ysize, bands, dtype<T>());
+    qb3_set_encoder_mode(p, qb3_mode(mode));
+    if (strips)
+        qb3_set_encoder_strips(p, strips);
+    if (q > 1)
+        qb3_set_encoder_quanta(p, q, false);
+    return p;
+}
+
+vector<uint8_t> encode(encsp p, const void* source) {
+    vector<uint8_t> out(qb3_max_encoded_size(p));
+    out.resize(qb3_encode(p, const_cast<void*>(source), out.data()));
+    return out;
+}
+
+// Decodes a formatted QB3 stream, returns an empty vector on failure
+template<typename T>
+vector<T> decode(const vector<uint8_t>& src, size_t threads = 1) {
+    size_t info[3];
+    auto p = qb3_read_start(const_cast<uint8_t*>(src.data()), src.size(), info);
+    if (!p)
+        return vector<T>();
+    qb3_set_decoder_threads(p, threads);
+    vector<T> out(info[0] * info[1] * info[2]);
+    if (!qb3_read_info(p) || qb3_read_data(p, out.data()) != out.size() * sizeof(T))
+        out.clear();
+    qb3_destroy_decoder(p);
+    return out;
+}
+
+// Mode of a formatted QB3 stream
+qb3_mode mode_of(const vector<uint8_t>& src) {
+    size_t info[3];
+    auto p = qb3_read_start(const_cast<uint8_t*>(src.data()), src.size(), info);
+    if (!p)
+        return QB3M_INVALID;
+    auto mode = qb3_read_info(p) ? qb3_get_mode(p) : QB3M_INVALID;
+    qb3_destroy_decoder(p);
+    return mode;
+}
+
+// Bounded encoding with the qb3_encode size as capacity gives the same output, in every mode
+template<typename T>
+void bounded(mt19937& rng) {
+    const char* name = "bounded";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t strips : {0, 2})
+            for (size_t q : {1, 3}) {
+                size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+                auto img = image<T>(x, y, bands, rng);
+                auto p = encoder<T>(x, y, bands, mode, strips, q);
+                auto ref = encode(p, img.data());
+                check(!ref.empty(), name, "qb3_encode failed");
+                // The byte after the capacity should not change
+                vector<uint8_t> out(ref.size() + 1, 0xcd);
+                auto len = qb3_encode_bounded(p, img.data(), out.data(), ref.size());
+                check(len == ref.size() && 0 == memcmp(out.data(), ref.data(), len), name,
+                    "not the same as qb3_encode");
+                check(0xcd == out[ref.size()], name, "wrote past the capacity");
+                out.resize(len);
+                if (1 == q)
+                    check(decode<T>(out) == img, name, "round trip");
+                // Too small fails, the encoder can still be used
+                check(0 == qb3_encode_bounded(p, img.data(), out.data(), 16), name, "fits in 16 bytes");
+                check(QB3E_NOSPACE == qb3_get_encoder_state(p), name, "no QB3E_NOSPACE");
+                check(encode(p, img.data()) == ref, name, "encoder not usable after failure");
+                qb3_destroy_encoder(p);
+            }
+}
+
+// RLE that doesn't help is dropped, as qb3_encode does
+void bounded_norle() {
+    const char* name = "bounded_norle";
+    const size_t x = 69, y = 69, bands = 3;
+    mt19937 rng(5);
+    vector<uint64_t> img(x * y * bands);
+    for (auto& v : img)
+        v = rng() % 100000;
+    auto p = encoder<uint64_t>(x, y, bands, QB3M_CF_RLE_H, 0, 3);
+    auto ref = encode(p, img.data());
+    vector<uint8_t> out(ref.size());
+    auto len = qb3_encode_bounded(p, img.data(), out.data(), out.size());
+    check(len == ref.size() && out == ref, name, "not the same as qb3_encode");
+    qb3_destroy_encoder(p);
+}
+
+// Sampling all the rows gives the qb3_encode sizes, or the stored size when that's smaller
+// The mode returned can be set, noise gets the fastest one
+template<typename T>
+void estimate(mt19937& rng) {
+    const char* name = "estimate";
+    for (int order : {QB3M_BASE_Z, QB3M_BASE_H})
+        for (bool noise : {false, true}) {
+            size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+            auto img = image<T>(x, y, bands, rng);
+            if (noise)
+                for (auto& v : img)
+                    v = T(rng());
+            auto p = encoder<T>(x, y, bands, order);
+            size_t sizes[5];
+            auto mode = qb3_estimate(p, img.data(), 1, 0.05, sizes);
+            check(QB3M_INVALID != mode && qb3_set_encoder_mode(p, mode) == mode, name, "mode can't be set");
+            check(!noise || order == mode, name, "noise is not the fastest mode");
+            // Fast, best, fast + RLE and best + RLE follow the mode values
+            // Between the raw and the stored size, the choice depends on packing
+            auto raw = x * y * bands * sizeof(T);
+            for (int i = 0; i < 4; i++) {
+                if (sizes[i] >= raw && sizes[i] < sizes[4])
+                    continue;
+                auto q = encoder<T>(x, y, bands, order + i);
+                check(qb3_encoded_size(q, img.data()) == min(sizes[i], sizes[4]), name,
+                    "not the qb3_encode size");
+                qb3_destroy_encoder(q);
+            }
+            qb3_destroy_encoder(p);
+        }
+}
+
+// Streams in RLE modes fit in qb3_max_encoded_size, even when packing grows the data
+void rle_growth() {
+    const char* name = "rle_growth";
+    mt19937 rng(11);
+    for (int it = 0; it < 4; it++) {
+        size_t x = 32 + rng() % 100, y = 32 + rng() % 100, bands = 1;
+        // A checkerboard of 0 and the top bit encodes to mostly FF bytes
+        vector<uint32_t> img(x * y * bands);
+        for (size_t i = 0; i < img.size(); i++)
+            img[i] = ((i % x + i / x) % 2) ? 0x80000000u : 0;
+        for (int mode : {QB3M_RLE, QB3M_CF_RLE, QB3M_RLE_H, QB3M_CF_RLE_H})
+            for (size_t q : {1, 2}) {
+                auto p = encoder<uint32_t>(x, y, bands, mode, 0, q);
+                vector<uint8_t> out(qb3_max_encoded_size(p));
+                size_t len = 0;
+                if (qb3_encode_begin(p, out.data()) && qb3_encode_rows(p, img.data(), y))
+                    len = qb3_encode_end(p);
+                check(0 != len, name, "stream failed");
+                out.resize(len);
+                if (len && 1 == q)
+                    check(decode<uint32_t>(out) == img, name, "round trip");
+                qb3_destroy_encoder(p);
+            }
+    }
+}
+
+// Lines passed in random groups encode the same as qb3_encode, which can choose stored or no RLE
+template<typename T>
+void stream(mt19937& rng) {
+    const char* name = "stream";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t strips : {0, 2}) {
+            size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+            auto img = image<T>(x, y, bands, rng);
+            auto p = encoder<T>(x, y, bands, mode, strips);
+            auto ref = encode(p, img.data());
+            vector<uint8_t> out(qb3_max_encoded_size(p));
+            bool ok = qb3_encode_begin(p, out.data());
+            for (size_t line = 0; ok && line < y;) {
+                size_t n = min(y - line, size_t(1 + rng() % 9));
+                ok = qb3_encode_rows(p, img.data() + line * x * bands, n);
+                line += n;
+            }
+            out.resize(ok ? qb3_encode_end(p) : 0);
+            check(!out.empty(), name, "stream failed");
+            if (mode_of(ref) == mode)
+                check(out == ref, name, "not the same as qb3_encode");
+            check(decode<T>(out) == img, name, "round trip");
+            qb3_destroy_encoder(p);
+        }
+}
+
+// Rows read one block row at a time, into a wider destination, match qb3_read_data
+template<typename T>
+void read_rows(mt19937& rng) {
+    const char* name = "read_rows";
+    for (int mode : {QB3M_BASE_Z, QB3M_CF_H, QB3M_RLE_H})
+        for (size_t strips : {0, 3}) {
+            size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+            auto img = image<T>(x, y, bands, rng);
+            auto p = encoder<T>(x, y, bands, mode, strips);
+            auto src = encode(p, img.data());
+            qb3_destroy_encoder(p);
+            size_t info[3];
+            auto d = qb3_read_start(src.data(), src.size(), info);
+            check(d && qb3_read_info(d), name, "read failed");
+            if (!d)
+                continue;
+            const size_t stride = x * bands + 5;
+            vector<T> out(stride * y);
+            size_t line = 0, rows = 0;
+            while (line < y && qb3_read_rows(d, out.data() + line * stride, stride, &rows))
+                line += rows;
+            check(line == y && 0 == qb3_read_rows(d, out.data(), stride, &rows), name, "wrong line count");
+            bool same = true;
+            for (size_t i = 0; i < y; i++)
+                same = same && equal(img.begin() + i * x * bands, img.begin() + (i + 1) * x * bands,
+                    out.begin() + i * stride);
+            check(same, name, "not the same as qb3_read_data");
+            qb3_destroy_decoder(d);
+        }
+}
+
+// Windows match the same area of the image, including ones in the short last strip
+template<typename T>
+void window(mt19937& rng) {
+    const char* name = "window";
+    for (int it = 0; it < 20; it++) {
+        size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+        auto img = image<T>(x, y, bands, rng);
+        auto p = encoder<T>(x, y, bands, it % 2 ? QB3M_RLE_H : QB3M_BASE_H, it % 3);
+        auto src = encode(p, img.data());
+        qb3_destroy_encoder(p);
+        size_t w = 1 + rng() % x, h = 1 + rng() % y, x0 = rng() % (x - w + 1), y0 = rng() % (y - h + 1);
+        if (it % 4 == 0) // Bottom edge
+            y0 = y - h;
+        size_t info[3];
+        auto d = qb3_read_start(src.data(), src.size(), info);
+        check(d && qb3_read_info(d), name, "read failed");
+        if (!d)
+            continue;
+        vector<T> out(w * h * bands);
+        check(qb3_read_window(d, x0, y0, w, h, out.data(), 0) == out.size() * sizeof(T), name, "window failed");
+        bool same = true;
+        for (size_t i = 0; i < h; i++)
+            same = same && equal(out.begin() + i * w * bands, out.begin() + (i + 1) * w * bands,
+                img.begin() + ((y0 + i) * x + x0) * bands);
+        check(same, name, "not the same as the image");
+        qb3_destroy_decoder(d);
+        // Origin and size which wrap around when added
+        for (int c = 0; c < 2; c++) {
+            d = qb3_read_start(src.data(), src.size(), info);
+            qb3_read_info(d);
+            check(0 == (c ? qb3_read_window(d, 0, ~size_t(0), w, 2, out.data(), 0)
+                : qb3_read_window(d, ~size_t(0), 0, 2, h, out.data(), 0)), name, "wrapped window read");
+            qb3_destroy_decoder(d);
+        }
+    }
+}
+
+// Batch output matches qb3_encode_with for each image, images which don't fit get size 0
+void batch() {
+    const char* name = "batch";
+    mt19937 rng(19);
+    const size_t x = 40, y = 36, bands = 3, n = 12;
+    for (size_t threads : {1, 4}) {
+        auto p = encoder<uint16_t>(x, y, bands, QB3M_RLE_H, 3);
+        qb3_set_encoder_threads(p, threads);
+        auto cfg = qb3_create_config(p);
+        vector<vector<uint16_t>> imgs;
+        vector<vector<uint8_t>> refs, outs;
+        vector<void*> sources, destinations;
+        vector<size_t> sizes;
+        for (size_t i = 0; i < n; i++) {
+            imgs.push_back(image<uint16_t>(x, y, bands, rng));
+            vector<uint8_t> ref(qb3_max_encoded_size(p));
+            ref.resize(qb3_encode_with(cfg, imgs[i].data(), ref.data()));
+            refs.push_back(ref);
+            // Every third image gets too little space, the others exactly enough
+            sizes.push_back(i % 3 ? ref.size() : ref.size() - 1);
+            outs.push_back(vector<uint8_t>(ref.size()));
+        }
+        for (size_t i = 0; i < n; i++) {
+            sources.push_back(imgs[i].data());
+            destinations.push_back(outs[i].data());
+        }
+        // A failed call on the encoder doesn't affect the batch
+        vector<uint8_t> small(16);
+        check(0 == qb3_encode_bounded(p, imgs[0].data(), small.data(), small.size()), name, "fits in 16 bytes");
+        check(n - n / 3 == qb3_encode_batch(p, n, sources.data(), destinations.data(), sizes.data()), name,
+            "wrong count");
+        for (size_t i = 0; i < n; i++) {
+            if (i % 3)
+                check(sizes[i] == refs[i].size() && outs[i] == refs[i], name, "not the same as qb3_encode_with");
+            else
+                check(0 == sizes[i], name, "image doesn't fit");
+        }
+        // From the configuration, with no capacity limit
+        fill(sizes.begin(), sizes.end(), 0);
+        for (size_t i = 0; i < n; i++) {
+            outs[i].assign(qb3_max_encoded_size(p), 0);
+            destinations[i] = outs[i].data();
+        }
+        check(n == qb3_encode_batch(cfg, n, sources.data(), destinations.data(), sizes.data()), name, "wrong count");
+        for (size_t i = 0; i < n; i++)
+            check(sizes[i] == refs[i].size() && equal(refs[i].begin(), refs[i].end(), outs[i].begin()), name,
+                "not the same as qb3_encode_with");
+        check(0 == qb3_encode_batch(cfg, n, nullptr, destinations.data(), sizes.data()), name, "no sources");
+        qb3_destroy_config(cfg);
+        qb3_destroy_encoder(p);
+    }
+}
+
+// Raw streams decode the same as the formatted ones, when given the same settings
+// Stored streams are not quantized
+template<typename T>
+void raw(mt19937& rng) {
+    const char* name = "raw";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t q : {1, 3}) {
+            size_t x = 4 + rng() % 30, y = 4 + rng() % 30, bands = 1 + rng() % 4;
+            auto img = image<T>(x, y, bands, rng);
+            auto p = encoder<T>(x, y, bands, mode, 0, q);
+            auto fmt = encode(p, img.data());
+            qb3_set_encoder_raw(p);
+            auto src = encode(p, img.data());
+            check(!src.empty(), name, "qb3_encode failed");
+            bool stored = (src.size() == img.size() * sizeof(T));
+            vector<uint8_t> out(src.size());
+            check(qb3_encode_bounded(p, img.data(), out.data(), out.size()) == src.size() && out == src, name,
+                "bounded not the same as qb3_encode");
+            qb3_destroy_encoder(p);
+            auto d = qb3_read_raw(src.data(), src.size(), x, y, bands, dtype<T>(), qb3_mode(mode));
+            check(nullptr != d, name, "qb3_read_raw failed");
+            if (!d)
+                continue;
+            if (q > 1)
+                check(qb3_set_decoder_quanta(d, q), name, "quanta");
+            vector<T> result(img.size());
+            check(qb3_read_data(d, result.data()) == result.size() * sizeof(T), name, "read failed");
+            if (stored || QB3M_STORED != mode_of(fmt))
+                check(result == (stored ? img : decode<T>(fmt)), name, "not the same as the formatted stream");
+            qb3_destroy_decoder(d);
+        }
+}
+
+// A plan decodes other images with the same parameters as the normal decoder does
+void plan() {
+    const char* name = "plan";
+    mt19937 rng(22);
+    const size_t x = 37, y = 29, bands = 3, stride = x * bands + 3;
+    for (int mode : {QB3M_BASE_Z, QB3M_CF_H, QB3M_RLE_H})
+        for (size_t strips : {0, 2}) {
+            auto p = encoder<uint16_t>(x, y, bands, mode, strips);
+            vector<vector<uint8_t>> srcs;
+            vector<vector<uint16_t>> imgs;
+            for (int i = 0; i < 4; i++) {
+                imgs.push_back(image<uint16_t>(x, y, bands, rng));
+                srcs.push_back(encode(p, imgs.back().data()));
+            }
+            qb3_destroy_encoder(p);
+            size_t info[3];
+            auto d = qb3_read_start(srcs[0].data(), srcs[0].size(), info);
+            auto pl = (d && qb3_read_info(d)) ? qb3_create_plan(d) : nullptr;
+            check(nullptr != pl, name, "qb3_create_plan failed");
+            if (d)
+                qb3_destroy_decoder(d); // The plan is independent
+            if (!pl)
+                continue;
+            for (size_t i = 0; i < srcs.size(); i++) {
+                vector<uint16_t> out(stride * y);
+                check(qb3_decode_with_plan(pl, srcs[i].data(), srcs[i].size(), out.data(), stride) != 0, name,
+                    "decode failed");
+                auto ref = decode<uint16_t>(srcs[i]);
+                bool same = !ref.empty();
+                for (size_t l = 0; l < y && same; l++)
+                    same = equal(ref.begin() + l * x * bands, ref.begin() + (l + 1) * x * bands,
+                        out.begin() + l * stride);
+                check(same, name, "not the same as qb3_read_data");
+            }
+            // Different image size
+            auto other = encoder<uint16_t>(x + 1, y, bands, mode, strips);
+            auto img = image<uint16_t>(x + 1, y, bands, rng);
+            auto src = encode(other, img.data());
+            qb3_destroy_encoder(other);
+            vector<uint16_t> out(img.size());
+            check(0 == qb3_decode_with_plan(pl, src.data(), src.size(), out.data(), 0), name, "wrong size accepted");
+            qb3_destroy_plan(pl);
+        }
+}
+
+// A configuration encodes the same as the encoder it was made from, which can change later
+template<typename T>
+void config(mt19937& rng) {
+    const char* name = "config";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t strips : {0, 2}) {
+            size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4, q = 1 + mode % 3;
+            auto img = image<T>(x, y, bands, rng);
+            auto p = encoder<T>(x, y, bands, mode, strips, q);
+            auto ref = encode(p, img.data());
+            auto cfg = qb3_create_config(p);
+            check(nullptr != cfg, name, "qb3_create_config failed");
+            if (!cfg)
+                continue;
+            vector<uint8_t> out(qb3_max_encoded_size(p));
+            qb3_set_encoder_mode(p, qb3_mode((mode + 1) % 8));
+            for (int i = 0; i < 2; i++) {
+                auto len = qb3_encode_with(cfg, img.data(), out.data());
+                check(len == ref.size() && equal(ref.begin(), ref.end(), out.begin()), name,
+                    "not the same as qb3_encode");
+            }
+            qb3_destroy_config(cfg);
+            qb3_destroy_encoder(p);
+        }
+}
+
+// The size without output is the qb3_encode size
+template<typename T>
+void encoded_size(mt19937& rng) {
+    const char* name = "encoded_size";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t strips : {0, 2})
+            for (bool raw : {false, true}) {
+                size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4, q = 1 + mode % 2;
+                auto img = image<T>(x, y, bands, rng);
+                auto p = encoder<T>(x, y, bands, mode, strips, q);
+                if (raw)
+                    qb3_set_encoder_raw(p);
+                auto len = qb3_encoded_size(p, img.data());
+                check(len == encode(p, img.data()).size(), name, "not the qb3_encode size");
+                qb3_destroy_encoder(p);
+            }
+}
+
+// Adaptive output, with noisy strips stored, reads back the same with every decoding call
+template<typename T>
+void adaptive(mt19937& rng) {
+    const char* name = "adaptive";
+    for (int mode : {QB3M_CF_H, QB3M_CF_RLE_H, QB3M_BASE_H})
+        for (size_t strips : {0, 1, 2}) {
+            size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+            auto img = image<T>(x, y, bands, rng);
+            for (size_t i = 0; i < img.size() / 2; i++) // Top half is noise
+                img[i] = T(rng());
+            auto p = encoder<T>(x, y, bands, mode, strips);
+            qb3_set_encoder_adaptive(p, true);
+            auto src = encode(p, img.data());
+            check(decode<T>(src) == img, name, "round trip");
+            check(qb3_encoded_size(p, img.data()) == src.size(), name, "not the qb3_encode size");
+            vector<uint8_t> out(src.size());
+            auto len = qb3_encode_bounded(p, img.data(), out.data(), out.size());
+            check(len == src.size() && out == src, name, "bounded not the same as qb3_encode");
+            out.assign(qb3_max_encoded_size(p), 0);
+            len = 0;
+            if (qb3_encode_begin(p, out.data()) && qb3_encode_rows(p, img.data(), y))
+                len = qb3_encode_end(p);
+            out.resize(len);
+            check(0 != len && decode<T>(out) == img, name, "stream round trip");
+            qb3_destroy_encoder(p);
+
+            size_t info[3];
+            auto d = qb3_read_start(src.data(), src.size(), info);
+            if (!d || !qb3_read_info(d)) {
+                check(false, name, "read failed");
+                if (d)
+                    qb3_destroy_decoder(d);
+                continue;
+            }
+            auto pl = qb3_create_plan(d);
+            vector<T> result(img.size());
+            check(pl && qb3_decode_with_plan(pl, src.data(), src.size(), result.data(), 0) && result == img, name,
+                "plan");
+            if (pl)
+                qb3_destroy_plan(pl);
+            // The bottom half of the image, as a window
+            size_t y0 = y / 2;
+            result.assign((y - y0) * x * bands, 0);
+            check(qb3_read_window(d, 0, y0, x, y - y0, result.data(), 0)
+                && equal(result.begin(), result.end(), img.begin() + y0 * x * bands), name, "window");
+            qb3_destroy_decoder(d);
+            // Row by row
+            d = qb3_read_start(src.data(), src.size(), info);
+            result.assign(img.size(), 0);
+            size_t line = 0, rows = 0;
+            if (d && qb3_read_info(d))
+                while (line < y && qb3_read_rows(d, result.data() + line * x * bands, 0, &rows))
+                    line += rows;
+            check(line == y && result == img, name, "rows");
+            if (d)
+                qb3_destroy_decoder(d);
+        }
+}
+
+// Strips encode the same with any number of threads, and decode back
+template<typename T>
+void strips(mt19937& rng) {
+    const char* name = "strips";
+    for (int mode = 0; mode < 8; mode++) {
+        size_t x = 16 + rng() % 50, y = 40 + rng() % 80, bands = 1 + rng() % 4;
+        auto img = image<T>(x, y, bands, rng);
+        auto p = encoder<T>(x, y, bands, mode, 1 + rng() % 3);
+        auto ref = encode(p, img.data());
+        check(decode<T>(ref) == img, name, "round trip");
+        for (size_t threads : {2, 3, 8, 0}) {
+            qb3_set_encoder_threads(p, threads);
+            check(encode(p, img.data()) == ref, name, "depends on the thread count");
+        }
+        qb3_destroy_encoder(p);
+    }
+}
+
+// Strips decode in parallel with any number of threads, including stored and RLE strips
+template<typename T>
+void strip_decode(mt19937& rng) {
+    const char* name = "strip_decode";
+    for (int mode = 0; mode < 8; mode++) {
+        size_t x = 16 + rng() % 50, y = 40 + rng() % 80, bands = 1 + rng() % 4;
+        auto img = image<T>(x, y, bands, rng);
+        for (size_t i = 0; i < x * bands * 12; i++) // A noisy strip at the top gets stored
+            img[i] = T(rng());
+        auto p = encoder<T>(x, y, bands, mode, 1 + rng() % 3);
+        qb3_set_encoder_adaptive(p, true);
+        auto src = encode(p, img.data());
+        qb3_destroy_encoder(p);
+        for (size_t threads : {1, 2, 5, 0})
+            check(decode<T>(src, threads) == img, name, "round trip");
+    }
+}
+
+// RLE streams expanded one block row at a time match the image
+// Mostly zero, so runs cross the block rows, with lines that encode to FF bytes
+// The CF modes encode zeros compactly, so RLE doesn't help there and it's dropped
+template<typename T>
+void rle_rows(mt19937& rng) {
+    const char* name = "rle_rows";
+    for (int mode : {QB3M_RLE, QB3M_RLE_H})
+        for (size_t strips : {0, 2}) {
+            size_t x = 16 + rng() % 100, y = 16 + rng() % 50, bands = 1 + rng() % 3;
+            vector<T> img(x * y * bands);
+            for (size_t i = 0; i < img.size(); i++)
+                if (0 == rng() % 400)
+                    img[i] = T(rng());
+                else if ((i / (x * bands)) % 13 == 5) // Checkerboard of 0 and the top bit
+                    img[i] = ((i / bands) % 2) ? T(T(1) << (8 * sizeof(T) - 1)) : T(0);
+            auto p = encoder<T>(x, y, bands, mode, strips);
+            auto src = encode(p, img.data());
+            qb3_destroy_encoder(p);
+            check(mode_of(src) == mode, name, "RLE not used");
+            size_t info[3];
+            auto d = qb3_read_start(src.data(), src.size(), info);
+            check(d && qb3_read_info(d), name, "read failed");
+            if (!d)
+                continue;
+            vector<T> out(img.size());
+            size_t line = 0, rows = 0;
+            while (line < y && qb3_read_rows(d, out.data() + line * x * bands, 0, &rows))
+                line += rows;
+            check(line == y && out == img, name, "not the same as the image");
+            qb3_destroy_decoder(d);
+        }
+}
+
+// Noise of many lengths between zero runs, so the RLE literal scan stops at every
+// position within its vectors, in the encoder and in the decoder
+void rle_literals() {
+    const char* name = "rle_literals";
+    mt19937 rng(29);
+    const size_t x = 160, y = 128;
+    for (int mode : {QB3M_RLE, QB3M_RLE_H}) {
+        vector<uint8_t> img(x * y);
+        for (size_t l = 0; l < y; l += 4) {
+            size_t len = rng() % 100, start = rng() % (x - len);
+            for (size_t i = l * x; i < (l + 4) * x; i += x)
+                for (size_t j = start; j < start + len; j++)
+                    img[i + j] = uint8_t(rng());
+        }
+        auto p = encoder<uint8_t>(x, y, 1, mode);
+        auto src = encode(p, img.data());
+        qb3_destroy_encoder(p);
+        check(mode_of(src) == mode, name, "RLE not used");
+        check(decode<uint8_t>(src) == img, name, "round trip");
+    }
+}
+
+// Value v quantized by q and restored, saturated at the limits of T
+template<typename T>
+T quantized(T v, size_t q, bool away) {
+    bool neg = numeric_limits<T>::is_signed && v < T(0);
+    uint64_t a = neg ? uint64_t(0) - uint64_t(int64_t(v)) : uint64_t(v);
+    uint64_t d = a / q;
+    d += (a - d * q) > (away ? (q - 1) / 2 : q / 2);
+    int64_t e = neg ? -int64_t(d * q) : int64_t(d * q);
+    return T(min(max(e, int64_t(numeric_limits<T>::min())), int64_t(numeric_limits<T>::max())));
+}
+
+// Quantized images decode to the nearest multiple of q, ties go to zero or away from zero
+// Stored images are not quantized
+template<typename T>
+void quanta(mt19937& rng) {
+    const char* name = "quanta";
+    for (int mode = 0; mode < 8; mode++)
+        for (size_t q : {2, 3, 10})
+            for (bool away : {false, true}) {
+                size_t x = 16 + rng() % 50, y = 16 + rng() % 50, bands = 1 + rng() % 4;
+                auto img = image<T>(x, y, bands, rng);
+                for (size_t i = 0; i < img.size(); i += 3) // Negative ones too, when signed
+                    img[i] = T(int64_t(rng() % 4000) - (numeric_limits<T>::is_signed ? 2000 : 0));
+                auto p = encoder<T>(x, y, bands, mode);
+                check(qb3_set_encoder_quanta(p, q, away), name, "quanta not set");
+                auto src = encode(p, img.data());
+                qb3_destroy_encoder(p);
+                auto out = decode<T>(src);
+                bool stored = QB3M_STORED == mode_of(src), same = out.size() == img.size();
+                for (size_t i = 0; same && i < img.size(); i++)
+                    same = out[i] == (stored ? img[i] : quantized(img[i], q, away));
+                check(same, name, "not the nearest multiple");
+            }
+}
+
+// Dequantization saturates at the type limits, the same way when reading rows, windows
+// or strips in parallel
+template<typename T>
+void dequant(mt19937& rng) {
+    const char* name = "dequant";
+    for (int mode : {QB3M_BASE_Z, QB3M_CF_H, QB3M_RLE_H})
+        for (size_t q : {3, 10}) {
+            size_t x = 16 + rng() % 50, y = 40 + rng() % 50, bands = 1 + rng() % 4;
+            // Smooth, with lines close to the limits, where rounding away overflows
+            vector<T> img(x * y * bands);
+            for (size_t i = 0; i < img.size(); i++) {
+                auto l = i / (x * bands);
+                img[i] = (l % 6 == 2) ? T(numeric_limits<T>::max() - rng() % 8)
+                    : (l % 6 == 4) ? T(numeric_limits<T>::min() + rng() % 8) : T(i % x + l + rng() % 3);
+            }
+            auto p = encoder<T>(x, y, bands, mode, 2);
+            qb3_set_encoder_quanta(p, q, true);
+            auto src = encode(p, img.data());
+            qb3_destroy_encoder(p);
+            check(QB3M_STORED != mode_of(src), name, "stored");
+            vector<T> ref(img.size());
+            for (size_t i = 0; i < img.size(); i++)
+                ref[i] = quantized(img[i], q, true);
+            check(decode<T>(src, 3) == ref, name, "not the nearest multiple");
+            size_t info[3], line = 0, rows = 0;
+            auto d = qb3_read_start(src.data(), src.size(), info);
+            check(d && qb3_read_info(d), name, "read failed");
+            if (!d)
+                continue;
+            vector<T> out(img.size());
+            while (line < y && qb3_read_rows(d, out.data() + line * x * bands, 0, &rows))
+                line += rows;
+            check(out == ref, name, "rows are not the same");
+            qb3_destroy_decoder(d);
+            // Bottom half, starting on a line which is not at a block boundary
+            size_t y0 = y / 2 + 1;
+            d = qb3_read_start(src.data(), src.size(), info);
+            qb3_read_info(d);
+            out.assign((y - y0) * x * bands, T(0));
+            check(qb3_read_window(d, 0, y0, x, y - y0, out.data(), 0) == out.size() * sizeof(T)
+                && equal(out.begin(), out.end(), ref.begin() + y0 * x * bands), name, "window is not the same");
+            qb3_destroy_decoder(d);
+        }
+}
+
+// Tasks passed to a host executor, which runs them right away or keeps them for later
+struct host_tasks {
+    vector<pair<qb3_task, void*>> later;
+    size_t calls;
+};
+
+static void run_now(qb3_task task, void* arg, void* context) {
+    static_cast<host_tasks*>(context)->calls++;
+    task(arg);
+}
+
+static void run_later(qb3_task task, void* arg, void* context) {
+    auto h = static_cast<host_tasks*>(context);
+    h->calls++;
+    h->later.emplace_back(task, arg);
+}
+
+// The library thread count and a host executor don't change the output
+// Tasks which the executor runs after the call returned don't do anything
+void executor() {
+    const char* name = "executor";
+    mt19937 rng(31);
+    const size_t x = 50, y = 96, bands = 3;
+    auto img = image<uint16_t>(x, y, bands, rng);
+    auto p = encoder<uint16_t>(x, y, bands, QB3M_RLE_H, 1);
+    auto ref = encode(p, img.data());
+    qb3_set_encoder_threads(p, 0); // Use the library setting
+    for (size_t threads : {1, 3, 0}) {
+        qb3_set_threads(threads);
+        check(encode(p, img.data()) == ref, name, "depends on qb3_set_threads");
+        check(decode<uint16_t>(ref, 0) == img, name, "round trip");
+    }
+    qb3_set_encoder_threads(p, 4);
+    for (auto fn : {run_now, run_later}) {
+        host_tasks h;
+        h.calls = 0;
+        qb3_set_executor(fn, &h);
+        check(encode(p, img.data()) == ref, name, "depends on the executor");
+        check(decode<uint16_t>(ref, 4) == img, name, "round trip with the executor");
+        qb3_set_executor(nullptr, nullptr);
+        check(h.calls > 0, name, "executor not used");
+        for (auto& t : h.later)
+            t.first(t.second);
+    }
+    qb3_destroy_encoder(p);
+}
+
+// Writes the encoded and decoded bytes for every mode, with and without strips and quanta
+// ctest runs this with each QB3_ISA and checks that the outputs are the same
+template<typename T>
+void isa_output(FILE* f) {
+    mt19937 rng(3);
+    const size_t x = 67, y = 45, bands = 3;
+    auto img = image<T>(x, y, bands, rng);
+    for (size_t i = x * bands * 16; i < x * bands * 24; i++) // Full range, for the high rungs
+        img[i] = T((uint64_t(rng()) << 32) | rng());
+    for (size_t q : {1, 3})
+        for (int mode = 0; mode < 8; mode++) {
+            auto p = encoder<T>(x, y, bands, mode, mode % 2 ? 2 : 0, q);
+            auto src = encode(p, img.data());
+            qb3_destroy_encoder(p);
+            auto out = decode<T>(src);
+            fwrite(src.data(), 1, src.size(), f);
+            fwrite(out.data(), sizeof(T), out.size(), f);
+        }
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && 0 == strcmp(argv[1], "isa")) {
+        FILE* f = fopen(argv[2], "wb");
+        if (!f)
+            return 1;
+        isa_output<uint8_t>(f);
+        isa_output<int8_t>(f);
+        isa_output<uint16_t>(f);
+        isa_output<int16_t>(f);
+        isa_output<uint32_t>(f);
+        isa_output<int32_t>(f);
+        isa_output<uint64_t>(f);
+        isa_output<int64_t>(f);
+        return fclose(f) ? 1 : 0;
+    }
+
+    mt19937 rng(1);
+    bounded<uint8_t>(rng);
+    bounded<uint16_t>(rng);
+    bounded<uint32_t>(rng);
+    bounded_norle();
+    estimate<uint8_t>(rng);
+    estimate<uint16_t>(rng);
+    rle_growth();
+    window<uint8_t>(rng);
+    window<uint32_t>(rng);
+    stream<uint8_t>(rng);
+    stream<uint16_t>(rng);
+    stream<uint32_t>(rng);
+    read_rows<uint8_t>(rng);
+    read_rows<uint16_t>(rng);
+    batch();
+    raw<uint8_t>(rng);
+    raw<uint16_t>(rng);
+    plan();
+    config<uint8_t>(rng);
+    config<uint16_t>(rng);
+    encoded_size<uint8_t>(rng);
+    encoded_size<uint32_t>(rng);
+    adaptive<uint8_t>(rng);
+    adaptive<uint16_t>(rng);
+    strips<uint8_t>(rng);
+    strips<uint16_t>(rng);
+    strip_decode<uint8_t>(rng);
+    strip_decode<uint32_t>(rng);
+    rle_rows<uint8_t>(rng);
+    rle_rows<uint16_t>(rng);
+    rle_rows<uint32_t>(rng);
+    rle_literals();
+    quanta<uint8_t>(rng);
+    quanta<int8_t>(rng);
+    quanta<int16_t>(rng);
+    quanta<uint32_t>(rng);
+    quanta<int32_t>(rng);
+    dequant<uint8_t>(rng);
+    dequant<int8_t>(rng);
+    dequant<uint16_t>(rng);
+    dequant<int16_t>(rng);
+    executor();
+
+    if (failures)
+        fprintf(stderr, "%d checks failed\n", failures);
+    return failures ? 1 : 0;
+}